@@ -0,0 +1,49 @@
+// ============================================================================
+// TextCPP - High Performance String Utility Library
+// ----------------------------------------------------------------------------
+// File:        alloc_counter.cpp
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#include "alloc_counter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+
+namespace
+{
+    std::atomic<uint64_t> Allocations{ 0 };
+
+    void* CountedAllocate(std::size_t size, std::size_t align)
+    {
+        Allocations.fetch_add(1, std::memory_order_relaxed);
+
+        if (size == 0) size = 1;
+        void* p = align <= alignof(std::max_align_t) ? std::malloc(size) : std::aligned_alloc(align, (size + align - 1) & ~(align - 1));
+        if (!p) throw std::bad_alloc();
+
+        return p;
+    }
+}
+
+
+uint64_t AllocationCount() { return Allocations.load(std::memory_order_relaxed); }
+
+
+// The array and nothrow forms call these by default, so replacing the two allocating forms counts every new.
+void* operator new(std::size_t size) { return CountedAllocate(size, alignof(std::max_align_t)); }
+void* operator new(std::size_t size, std::align_val_t align) { return CountedAllocate(size, static_cast<std::size_t>(align)); }
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
@@ -0,0 +1,42 @@
+// ============================================================================
+// TextCPP - High Performance String Utility Library
+// ----------------------------------------------------------------------------
+// File:        alloc_counter.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+
+#ifndef __ALLOC_COUNTER_H_GUARD
+#define __ALLOC_COUNTER_H_GUARD
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+
+
+/// <summary>
+/// Number of calls to the global operator new since the program started, from every thread.
+/// alloc_counter.cpp replaces operator new to count them, so it must be linked into the benchmark.
+/// </summary>
+uint64_t AllocationCount();
+
+
+/// <summary>
+/// Reports allocations as the allocs/op counter: the number counted while the benchmark ran, divided by its iterations.
+/// </summary>
+inline void ReportAllocations(benchmark::State& state, uint64_t allocations)
+{
+    state.counters["allocs/op"] = benchmark::Counter(static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+}
+
+
+
+#endif
@@ -0,0 +1,303 @@
+// ============================================================================
+// TextCPP - High Performance String Utility Library
+// ----------------------------------------------------------------------------
+// File:        fixed_string_bench.cpp
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#include "alloc_counter.h"
+#include "fixed_string.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+
+/// <summary>
+/// Every benchmark runs for each buffer size N in 8, 16, ..., 4096 on text of N - 1 characters, filling
+/// the buffer. The same lengths are run for std::string, which keeps 7 and 15 characters inline (SSO)
+/// and allocates from 31 up, and for std::string_view over separately owned text. Names are
+/// Operation/Type/N, and every run reports allocs/op; std::string runs also report heap, which is 1
+/// when the string's characters live outside the object.
+/// </summary>
+namespace
+{
+    constexpr size_t VectorCount = 1024;                        // Elements in the sort and lookup vectors
+
+    template<typename T> struct TypeName;
+    template<size_t N> struct TypeName<FixedString<N>> { static std::string Get() { return "FixedString"; } };
+    template<size_t N> struct TypeName<FixedString<N, LengthPolicy::Stored>> { static std::string Get() { return "FixedStringStored"; } };
+    template<> struct TypeName<std::string> { static std::string Get() { return "std::string"; } };
+    template<> struct TypeName<std::string_view> { static std::string Get() { return "std::string_view"; } };
+
+    /// <summary>
+    /// Text of length characters: a shared run of 'k' and a random suffix of up to eight letters, so
+    /// equal-length keys differ only near the end and ordering and equality read all of them.
+    /// </summary>
+    std::string MakeText(size_t length, std::mt19937& rng)
+    {
+        std::string text(length, 'k');
+        const size_t suffix = length < 8 ? length : 8;
+
+        for (size_t i = length - suffix; i < length; ++i) text[i] = static_cast<char>('a' + rng() % 26);
+        return text;
+    }
+
+    /// <summary>
+    /// VectorCount texts of one length. The std::string_view runs point into the returned strings.
+    /// </summary>
+    std::vector<std::string> MakeTexts(size_t length)
+    {
+        std::mt19937 rng(static_cast<uint32_t>(length));
+        std::vector<std::string> texts;
+        texts.reserve(VectorCount);
+
+        for (size_t i = 0; i < VectorCount; ++i) texts.push_back(MakeText(length, rng));
+        return texts;
+    }
+
+    template<size_t N, LengthPolicy L>
+    void Store(FixedString<N, L>& out, std::string_view text) { out.Assign(text); }
+    void Store(std::string& out, std::string_view text) { out.assign(text.data(), text.size()); }
+    void Store(std::string_view& out, std::string_view text) { out = text; }
+
+    template<typename T>
+    void ReportStorage(benchmark::State& state, const T&) { (void)state; }
+
+    void ReportStorage(benchmark::State& state, const std::string& str)
+    {
+        const char* object = reinterpret_cast<const char*>(&str);
+        state.counters["heap"] = str.data() >= object && str.data() < object + sizeof(str) ? 0 : 1;
+    }
+
+
+    template<typename T>
+    void Assign(benchmark::State& state, size_t length)
+    {
+        const std::vector<std::string> texts = MakeTexts(length);
+        T out{};
+        size_t i = 0;
+
+        const uint64_t before = AllocationCount();
+        for (auto _ : state)
+        {
+            Store(out, texts[i++ % VectorCount]);
+            benchmark::DoNotOptimize(out);
+        }
+
+        ReportAllocations(state, AllocationCount() - before);
+        ReportStorage(state, out);
+    }
+
+    template<typename T>
+    void Copy(benchmark::State& state, size_t length)
+    {
+        const std::vector<std::string> texts = MakeTexts(length);
+        const T source(texts[0]);
+
+        const uint64_t before = AllocationCount();
+        for (auto _ : state)
+        {
+            T copy(source);
+            benchmark::DoNotOptimize(copy);
+        }
+
+        ReportAllocations(state, AllocationCount() - before);
+        ReportStorage(state, source);
+    }
+
+    template<typename T>
+    void Length(benchmark::State& state, size_t length)
+    {
+        const std::vector<std::string> texts = MakeTexts(length);
+        T str(texts[0]);
+
+        const uint64_t before = AllocationCount();
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(str);                      // Forces length() to be recomputed
+            benchmark::DoNotOptimize(str.length());
+        }
+
+        ReportAllocations(state, AllocationCount() - before);
+    }
+
+    /// <summary>
+    /// Equal contents in separate objects, the worst case: every byte is compared.
+    /// </summary>
+    template<typename T, typename Other>
+    void Equal(benchmark::State& state, size_t length)
+    {
+        const std::vector<std::string> texts = MakeTexts(length);
+        const std::string otherText = texts[0];
+        T str(texts[0]);
+        Other other;
+
+        if constexpr (std::is_same_v<Other, const char*>) other = otherText.c_str();
+        else other = Other(otherText);
+
+        const uint64_t before = AllocationCount();
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(str);
+            benchmark::DoNotOptimize(other);
+            benchmark::DoNotOptimize(str == other);
+        }
+
+        ReportAllocations(state, AllocationCount() - before);
+    }
+
+    template<typename T>
+    void Hash(benchmark::State& state, size_t length)
+    {
+        const std::vector<std::string> texts = MakeTexts(length);
+        T str(texts[0]);
+        const std::hash<T> hasher;
+
+        const uint64_t before = AllocationCount();
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(str);
+            benchmark::DoNotOptimize(hasher(str));
+        }
+
+        ReportAllocations(state, AllocationCount() - before);
+    }
+
+    /// <summary>
+    /// str + C string. Both FixedString and std::string return a new std::string.
+    /// </summary>
+    template<typename T>
+    void Concat(benchmark::State& state, size_t length)
+    {
+        const std::vector<std::string> texts = MakeTexts(length);
+        T str(texts[0]);
+
+        const uint64_t before = AllocationCount();
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(str);
+            std::string joined = str + ".suffix";
+            benchmark::DoNotOptimize(joined);
+        }
+
+        ReportAllocations(state, AllocationCount() - before);
+    }
+
+    /// <summary>
+    /// std::sort of a vector of VectorCount strings. The unsorted copy made before each sort is not timed
+    /// and its allocations are not counted.
+    /// </summary>
+    template<typename T>
+    void Sort(benchmark::State& state, size_t length)
+    {
+        const std::vector<std::string> texts = MakeTexts(length);
+        const std::vector<T> source(texts.begin(), texts.end());
+        std::vector<T> work;
+        uint64_t allocations = 0;
+
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            work = source;
+            const uint64_t before = AllocationCount();
+            state.ResumeTiming();
+
+            std::sort(work.begin(), work.end());
+            benchmark::DoNotOptimize(work.data());
+
+            allocations += AllocationCount() - before;
+        }
+
+        ReportAllocations(state, allocations);
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * VectorCount));
+    }
+
+    /// <summary>
+    /// Binary search of a sorted vector of VectorCount strings, probing for each element in turn.
+    /// </summary>
+    template<typename T>
+    void Lookup(benchmark::State& state, size_t length)
+    {
+        const std::vector<std::string> texts = MakeTexts(length);
+        std::vector<T> sorted(texts.begin(), texts.end());
+        const std::vector<T> probes(texts.begin(), texts.end());
+        std::sort(sorted.begin(), sorted.end());
+
+        size_t i = 0;
+        const uint64_t before = AllocationCount();
+        for (auto _ : state)
+        {
+            const T& probe = probes[i++ % VectorCount];
+            benchmark::DoNotOptimize(std::lower_bound(sorted.begin(), sorted.end(), probe));
+        }
+
+        ReportAllocations(state, AllocationCount() - before);
+    }
+
+
+    template<typename T>
+    void Register(const char* operation, size_t n, void (*run)(benchmark::State&, size_t))
+    {
+        const std::string name = std::string(operation) + "/" + TypeName<T>::Get() + "/" + std::to_string(n);
+        benchmark::RegisterBenchmark(name.c_str(), [run, n](benchmark::State& state) { run(state, n - 1); });
+    }
+
+    /// <summary>
+    /// Registers every operation for T, whose buffer, for FixedString, is n bytes.
+    /// </summary>
+    template<typename T>
+    void RegisterType(size_t n)
+    {
+        constexpr bool isView = std::is_same_v<T, std::string_view>;
+
+        Register<T>("Assign", n, &Assign<T>);
+        Register<T>("Copy", n, &Copy<T>);
+        Register<T>("Length", n, &Length<T>);
+        Register<T>("EqualSame", n, &Equal<T, T>);
+        Register<T>("EqualCString", n, &Equal<T, const char*>);
+        Register<T>("EqualView", n, &Equal<T, std::string_view>);
+        Register<T>("Hash", n, &Hash<T>);
+        if constexpr (!isView) Register<T>("Concat", n, &Concat<T>);   // std::string_view has no operator+
+        Register<T>("Sort", n, &Sort<T>);
+        Register<T>("Lookup", n, &Lookup<T>);
+    }
+
+    template<size_t N>
+    void RegisterSize()
+    {
+        RegisterType<FixedString<N>>(N);
+        if constexpr (N <= 256) RegisterType<FixedString<N, LengthPolicy::Stored>>(N);
+        RegisterType<std::string>(N);
+        RegisterType<std::string_view>(N);
+    }
+
+    template<size_t... Shift>
+    void RegisterAll(std::index_sequence<Shift...>) { (RegisterSize<size_t(8) << Shift>(), ...); }
+}
+
+
+int main(int argc, char** argv)
+{
+    RegisterAll(std::make_index_sequence<10>());                // N = 8 ... 4096
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
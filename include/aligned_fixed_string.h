@@ -0,0 +1,86 @@
+// ============================================================================
+// TextCPP - High Performance String Utility Library
+// ----------------------------------------------------------------------------
+// File:        aligned_fixed_string.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+
+#ifndef __ALIGNED_FIXED_STRING_H_GUARD
+#define __ALIGNED_FIXED_STRING_H_GUARD
+
+#include "fixed_string.h"
+
+
+namespace FixedStringDetail
+{
+    /// <summary>
+    /// n rounded up to a multiple of align, a power of two.
+    /// </summary>
+    constexpr size_t RoundUpTo(size_t n, size_t align) { return (n + align - 1) & ~(align - 1); }
+}
+
+
+/// <summary>
+/// A FixedString that occupies whole cache lines: its buffer starts on an Align-byte boundary and is
+/// rounded up to a multiple of Align bytes, so neighbouring strings in an array never share a line.
+/// Use it for per-thread buffers kept side by side, such as status text written by each worker, where
+/// a plain FixedString&lt;48&gt; array would put two threads' strings on one line and cause false sharing.
+/// The padding would be wasted otherwise, so it becomes capacity: AlignedFixedString&lt;48&gt; holds 63 characters.
+/// Everything else is FixedString, and it binds to any FixedString&lt;Capacity, L&gt; parameter.
+/// </summary>
+/// <remarks>
+/// With Align of at least the SIMD width (32 bytes with AVX2, 16 otherwise) the buffer is a whole number of
+/// aligned blocks, so the search kernels, which load whole blocks anywhere in the buffer, never split a
+/// load across cache lines or need a tail step.
+/// It stays trivially copyable. Over-aligned types need C++17 aligned new, which std::vector uses.
+/// </remarks>
+/// <typeparam name="N">The smallest buffer size wanted, including the null terminator.</typeparam>
+/// <typeparam name="Align">Alignment and size granularity in bytes. A power of two; 64 is a cache line,
+/// 128 also covers adjacent-line prefetching.</typeparam>
+/// <typeparam name="L">How the length is tracked. See LengthPolicy.</typeparam>
+template<size_t N, size_t Align = 64, LengthPolicy L = LengthPolicy::Scan>
+class alignas(Align) AlignedFixedString : public FixedString<FixedStringDetail::RoundUpTo(N, Align), L>
+{
+    static_assert(N > 0, "AlignedFixedString: N must be > 0");
+    static_assert(Align > 0 && (Align & (Align - 1)) == 0, "AlignedFixedString: Align must be a power of two");
+
+    using Base = FixedString<FixedStringDetail::RoundUpTo(N, Align), L>;
+
+    public:
+        /// <summary>
+        /// The actual buffer size, including the null terminator: N rounded up to a multiple of Align.
+        /// </summary>
+        static constexpr size_t Capacity = FixedStringDetail::RoundUpTo(N, Align);
+
+        using Base::Base;
+        using Base::operator=;
+
+        AlignedFixedString() = default;
+};
+
+
+/// <summary>
+/// std::hash specialization matching FixedString: equal contents hash equally.
+/// </summary>
+namespace std
+{
+    template<size_t N, size_t Align, LengthPolicy L>
+    struct hash<AlignedFixedString<N, Align, L>>
+    {
+        size_t operator()(const AlignedFixedString<N, Align, L>& str) const noexcept { return static_cast<size_t>(str.Hash()); }
+    };
+}
+
+
+
+#endif
@@ -0,0 +1,480 @@
+// ============================================================================
+// TextCPP - High Performance String Utility Library
+// ----------------------------------------------------------------------------
+// File:        arena_string.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+
+#ifndef __ARENA_STRING_H_GUARD
+#define __ARENA_STRING_H_GUARD
+
+#include <new>
+
+#include "fixed_string.h"
+
+
+/// <summary>
+/// A bump allocator for string bytes. Allocation is a pointer increment within the current block,
+/// and Reset releases everything at once in O(1) by rewinding to the first block. Blocks are kept
+/// across Reset, so a per-request arena stops touching the heap once it has warmed up.
+/// </summary>
+/// <remarks>
+/// Not thread-safe; use one arena per thread or per request.
+/// An arena built over a caller-supplied buffer never allocates: when the buffer is exhausted
+/// Allocate returns nullptr.
+/// </remarks>
+class TextArena
+{
+    public:
+        /// <summary>
+        /// Constructs an arena that allocates heap blocks on demand. Nothing is allocated until first use.
+        /// </summary>
+        /// <param name="blockSize">Size in bytes of each block. Larger requests get a dedicated block.</param>
+        explicit TextArena(size_t blockSize = 64 * 1024) : BlockSize(blockSize > 0 ? blockSize : 1) {}
+
+        /// <summary>
+        /// Constructs an arena over a caller-supplied buffer. The arena never allocates and never frees the buffer.
+        /// </summary>
+        /// <param name="buffer">The storage. Must outlive the arena and every string allocated from it.</param>
+        /// <param name="size">Size of the buffer in bytes.</param>
+        TextArena(void* buffer, size_t size) : BlockSize(0)
+        {
+            External.Next = nullptr;
+            External.Begin = static_cast<char*>(buffer);
+            External.Size = size;
+            First = Current = &External;
+        }
+
+        TextArena(const TextArena&) = delete;
+        TextArena& operator=(const TextArena&) = delete;
+
+        ~TextArena()
+        {
+            for (Block* block = First; block;)
+            {
+                Block* next = block->Next;
+                if (block != &External) delete[] reinterpret_cast<char*>(block);
+                block = next;
+            }
+        }
+
+        /// <summary>
+        /// Allocates bytes of unaligned storage.
+        /// </summary>
+        /// <returns>The storage, or nullptr if the arena has a fixed buffer and it is exhausted.</returns>
+        char* Allocate(size_t bytes)
+        {
+            if (!Current || Current->Size - Offset < bytes)
+            {
+                if (!Advance(bytes)) return nullptr;
+            }
+
+            char* p = Current->Begin + Offset;
+            Offset += bytes;
+            Used += bytes;
+            return p;
+        }
+
+        /// <summary>
+        /// Grows the most recent allocation in place from oldSize to newSize bytes, if it ends at the top
+        /// of the current block and the block has room. Lets a builder append without copying.
+        /// </summary>
+        /// <returns>True if the allocation was extended.</returns>
+        bool TryExtend(const char* p, size_t oldSize, size_t newSize)
+        {
+            if (!Current || p + oldSize != Current->Begin + Offset || newSize < oldSize) return false;
+            if (Current->Size - Offset < newSize - oldSize) return false;
+
+            Offset += newSize - oldSize;
+            Used += newSize - oldSize;
+            return true;
+        }
+
+        /// <summary>
+        /// Shrinks the most recent allocation in place from oldSize to newSize bytes, if it ends at the top
+        /// of the current block, so the bytes past newSize are handed out again. Lets a builder give back
+        /// the unused part of its reservation.
+        /// </summary>
+        /// <returns>True if the allocation was shrunk.</returns>
+        bool TryShrink(const char* p, size_t oldSize, size_t newSize)
+        {
+            if (!Current || p + oldSize != Current->Begin + Offset || newSize > oldSize) return false;
+
+            Offset -= oldSize - newSize;
+            Used -= oldSize - newSize;
+            return true;
+        }
+
+        /// <summary>
+        /// Releases every allocation at once. O(1): the blocks are kept for reuse, not freed.
+        /// Every ArenaString from this arena is invalidated.
+        /// </summary>
+        void Reset()
+        {
+            Current = First;
+            Offset = 0;
+            Used = 0;
+        }
+
+        /// <summary>
+        /// Bytes handed out since construction or the last Reset.
+        /// </summary>
+        size_t BytesUsed() const { return Used; }
+
+        /// <summary>
+        /// Bytes held in blocks, including unused space.
+        /// </summary>
+        size_t BytesReserved() const
+        {
+            size_t total = 0;
+            for (const Block* block = First; block; block = block->Next) total += block->Size;
+            return total;
+        }
+
+    private:
+        struct Block
+        {
+            Block* Next;
+            char* Begin;
+            size_t Size;
+        };
+
+        /// <summary>
+        /// Moves to the next kept block if it can hold bytes, otherwise links in a new block after the current one.
+        /// </summary>
+        bool Advance(size_t bytes)
+        {
+            if (Current && Current->Next && Current->Next->Size >= bytes)
+            {
+                Current = Current->Next;
+                Offset = 0;
+                return true;
+            }
+
+            if (BlockSize == 0) return false;                      // Fixed buffer: never allocate
+
+            const size_t size = bytes > BlockSize ? bytes : BlockSize;
+            char* raw = new char[sizeof(Block) + size];
+
+            Block* block = reinterpret_cast<Block*>(raw);
+            block->Begin = raw + sizeof(Block);
+            block->Size = size;
+
+            if (Current) {
+                block->Next = Current->Next;
+                Current->Next = block;
+            }
+            else {
+                block->Next = nullptr;
+                First = block;
+            }
+
+            Current = block;
+            Offset = 0;
+            return true;
+        }
+
+        const size_t BlockSize;
+        Block External = {};
+        Block* First = nullptr;
+        Block* Current = nullptr;
+        size_t Offset = 0;
+        size_t Used = 0;
+};
+
+
+/// <summary>
+/// An immutable, null-terminated string whose bytes live in a TextArena. The object itself is a
+/// pointer and a length, so records can hold text of any length at its actual size instead of a
+/// worst-case FixedString buffer. It does not own its bytes: it is valid until the arena is Reset
+/// or destroyed, and copies share the same bytes.
+/// </summary>
+class ArenaString
+{
+    public:
+        /// <summary>
+        /// Constructs an empty string. Allocates nothing.
+        /// </summary>
+        ArenaString() = default;
+
+        /// <summary>
+        /// Copies a string into the arena with one memcpy.
+        /// </summary>
+        /// <param name="arena">The arena to allocate from.</param>
+        /// <param name="sv">The contents. std::string converts implicitly.</param>
+        /// <remarks>Asserts in debug builds if a fixed-buffer arena is exhausted; the string is then empty.</remarks>
+        ArenaString(TextArena& arena, std::string_view sv)
+        {
+            char* p = arena.Allocate(sv.size() + 1);
+
+            assert(p && "ArenaString: arena exhausted");
+            if (!p) return;
+
+            FixedStringDetail::CopyBytes(p, sv.data(), sv.size());
+            p[sv.size()] = '\0';
+
+            Ptr = p;
+            Length = sv.size();
+        }
+
+        /// <summary>
+        /// Copies a null-terminated C string into the arena. Null pointer is treated as empty string.
+        /// </summary>
+        ArenaString(TextArena& arena, const char* str) : ArenaString(arena, std::string_view(str ? str : "")) {}
+
+        /// <summary>
+        /// Copies the contents of a FixedString of any capacity or policy into the arena.
+        /// </summary>
+        template<size_t N, LengthPolicy L>
+        ArenaString(TextArena& arena, const FixedString<N, L>& str) : ArenaString(arena, static_cast<std::string_view>(str)) {}
+
+        /// <summary>
+        /// Adopts bytes already written into the arena, such as a finished ArenaStringBuilder. p[length] must be '\0'.
+        /// </summary>
+        static ArenaString FromArena(const char* p, size_t length) { ArenaString s; s.Ptr = p; s.Length = length; return s; }
+
+        /// <summary>
+        /// Returns a null-terminated pointer to the contents.
+        /// </summary>
+        const char* c_str() const { return Ptr; }
+
+        /// <summary>
+        /// Returns the length in characters, excluding the null terminator. O(1).
+        /// </summary>
+        size_t length() const { return Length; }
+
+        /// <summary>
+        /// Returns true if the string is empty.
+        /// </summary>
+        bool empty() const { return Length == 0; }
+
+        /// <summary>
+        /// Returns a view of the contents. Does not allocate.
+        /// </summary>
+        std::string_view View() const { return std::string_view(Ptr, Length); }
+
+        /// <summary>
+        /// Implicit conversion to std::string_view. Does not allocate.
+        /// </summary>
+        operator std::string_view() const { return View(); }
+
+        /// <summary>
+        /// Copies the contents into a FixedString. Asserts in debug builds if they do not fit, like FixedString::Assign.
+        /// </summary>
+        template<size_t N, LengthPolicy L = LengthPolicy::Scan>
+        FixedString<N, L> ToFixedString() const { FixedString<N, L> out(UninitializedTag{}); out.Assign(View()); return out; }
+
+        /// <summary>
+        /// Returns the same hash as FixedString::Hash over the same contents.
+        /// </summary>
+        uint64_t Hash(uint64_t seed = 0) const { return FixedStringDetail::Hash64(Ptr, Length, seed); }
+
+        /// <summary>
+        /// Three-way comparison. Same ordering as FixedString::Compare.
+        /// </summary>
+        int Compare(std::string_view other) const { return FixedStringDetail::CompareStrings(Ptr, Length, other.data(), other.size()); }
+
+        friend bool operator==(const ArenaString& a, const ArenaString& b) { return a.Length == b.Length && FixedStringDetail::BytesEqual(a.Ptr, b.Ptr, a.Length); }
+        friend bool operator!=(const ArenaString& a, const ArenaString& b) { return !(a == b); }
+        friend bool operator==(const ArenaString& a, std::string_view b) { return a.Length == b.size() && FixedStringDetail::BytesEqual(a.Ptr, b.data(), a.Length); }
+        friend bool operator!=(const ArenaString& a, std::string_view b) { return !(a == b); }
+        friend bool operator==(const ArenaString& a, const char* b) { return a == std::string_view(b ? b : ""); }
+        friend bool operator!=(const ArenaString& a, const char* b) { return !(a == b); }
+        friend bool operator<(const ArenaString& a, const ArenaString& b) { return a.Compare(b) < 0; }
+
+        template<size_t N, LengthPolicy L>
+        friend bool operator==(const ArenaString& a, const FixedString<N, L>& b) { return a == static_cast<std::string_view>(b); }
+        template<size_t N, LengthPolicy L>
+        friend bool operator!=(const ArenaString& a, const FixedString<N, L>& b) { return !(a == b); }
+
+    private:
+        const char* Ptr = "";
+        size_t Length = 0;
+};
+
+
+/// <summary>
+/// Builds an ArenaString piece by piece directly in a TextArena. While nothing else is allocated
+/// from the arena, appends extend the string in place at the top of the block; otherwise the contents
+/// move once to a block with room for twice the length. Build writes the terminator and returns the
+/// string without copying it, giving the unused tail of the reservation back to the arena when the
+/// builder's allocation is still the last one. Otherwise that tail, and any buffer left behind by a
+/// move, stay unused until the arena is Reset.
+/// </summary>
+class ArenaStringBuilder
+{
+    public:
+        /// <summary>
+        /// Constructs an empty builder over an arena. Nothing is allocated until the first append.
+        /// </summary>
+        explicit ArenaStringBuilder(TextArena& arena) : Arena(arena) {}
+
+        /// <summary>
+        /// Appends a string view.
+        /// </summary>
+        /// <returns>Reference to this builder, for chaining.</returns>
+        ArenaStringBuilder& Append(std::string_view sv)
+        {
+            if (!Reserve(Length + sv.size())) { Overflowed = true; return *this; }
+
+            FixedStringDetail::CopyBytes(Buffer + Length, sv.data(), sv.size());
+            Length += sv.size();
+            return *this;
+        }
+
+        /// <summary>
+        /// Appends a null-terminated C string. Null pointer is treated as empty string.
+        /// </summary>
+        ArenaStringBuilder& Append(const char* str) { return Append(std::string_view(str ? str : "")); }
+
+        /// <summary>
+        /// Appends a std::string without rescanning it.
+        /// </summary>
+        ArenaStringBuilder& Append(const std::string& str) { return Append(std::string_view(str)); }
+
+        /// <summary>
+        /// Appends a single character.
+        /// </summary>
+        ArenaStringBuilder& Append(char c) { return Append(std::string_view(&c, 1)); }
+
+        /// <summary>
+        /// Appends an integer or floating-point value in the shortest form of FixedString::AssignNumber,
+        /// so sb &lt;&lt; 42 appends "42" rather than converting to a character.
+        /// </summary>
+        template<typename T, std::enable_if_t<(std::is_integral_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char>) || std::is_floating_point_v<T>, int> = 0>
+        ArenaStringBuilder& Append(T value)
+        {
+            FixedString<32> text(UninitializedTag{});
+            text.AssignNumber(value);
+            return Append(static_cast<std::string_view>(text));
+        }
+
+        /// <summary>
+        /// Appends a FixedString of any capacity or policy.
+        /// </summary>
+        template<size_t M, LengthPolicy LM>
+        ArenaStringBuilder& Append(const FixedString<M, LM>& str) { return Append(static_cast<std::string_view>(str)); }
+
+        /// <summary>
+        /// Appends an ArenaString.
+        /// </summary>
+        ArenaStringBuilder& Append(const ArenaString& str) { return Append(str.View()); }
+
+        /// <summary>
+        /// Appends several pieces in order.
+        /// </summary>
+        template<typename First, typename Second, typename... Rest>
+        ArenaStringBuilder& Append(const First& first, const Second& second, const Rest&... rest)
+        {
+            Append(first);
+            return Append(second, rest...);
+        }
+
+        /// <summary>
+        /// Appends a piece. Equivalent to Append.
+        /// </summary>
+        template<typename T>
+        ArenaStringBuilder& operator+=(const T& piece) { return Append(piece); }
+
+        /// <summary>
+        /// Appends a piece. Equivalent to Append, useful for stream-style chains.
+        /// </summary>
+        template<typename T>
+        ArenaStringBuilder& operator<<(const T& piece) { return Append(piece); }
+
+        /// <summary>
+        /// Returns the current length in characters. O(1).
+        /// </summary>
+        size_t length() const { return Length; }
+
+        /// <summary>
+        /// Returns true if nothing has been appended.
+        /// </summary>
+        bool empty() const { return Length == 0; }
+
+        /// <summary>
+        /// Returns true if a piece was dropped, whole, because a fixed-buffer arena was exhausted.
+        /// Stays set from then on.
+        /// </summary>
+        bool Truncated() const { return Overflowed; }
+
+        /// <summary>
+        /// Returns a view of the contents so far. Not null-terminated until Build.
+        /// </summary>
+        std::string_view View() const { return std::string_view(Buffer ? Buffer : "", Length); }
+
+        /// <summary>
+        /// Null-terminates the contents and returns them as an ArenaString. The builder starts over empty;
+        /// the returned string keeps its bytes. If nothing was allocated from the arena since the last
+        /// append, the reserved space past the terminator is returned to it.
+        /// </summary>
+        ArenaString Build()
+        {
+            if (!Buffer) return ArenaString();                  // Nothing appended, or nothing fit
+
+            Buffer[Length] = '\0';                              // Reserve always keeps room for the terminator
+            Arena.TryShrink(Buffer, Capacity, Length + 1);
+            ArenaString out = ArenaString::FromArena(Buffer, Length);
+
+            Reset();
+            return out;
+        }
+
+    private:
+        /// <summary>
+        /// Ensures room for length characters plus a terminator, extending in place where possible.
+        /// </summary>
+        bool Reserve(size_t length)
+        {
+            if (Buffer && length + 1 <= Capacity) return true;
+
+            size_t capacity = Capacity < 32 ? 32 : Capacity * 2;
+            if (capacity < length + 1) capacity = length + 1;
+
+            if (Buffer && Arena.TryExtend(Buffer, Capacity, capacity)) { Capacity = capacity; return true; }
+
+            char* p = Arena.Allocate(capacity);
+            if (!p && length + 1 < capacity) p = Arena.Allocate(capacity = length + 1);        // A fixed buffer may still fit the exact size
+            if (!p) return false;
+
+            FixedStringDetail::CopyBytes(p, Buffer, Length);
+            Buffer = p;
+            Capacity = capacity;
+            return true;
+        }
+
+        void Reset() { Buffer = nullptr; Length = 0; Capacity = 0; }
+
+        TextArena& Arena;
+        char* Buffer = nullptr;
+        size_t Length = 0;
+        size_t Capacity = 0;
+        bool Overflowed = false;
+};
+
+
+namespace std
+{
+    /// <summary>
+    /// std::hash specialization for ArenaString. Hashes equal to FixedString over the same contents.
+    /// </summary>
+    template<>
+    struct hash<ArenaString>
+    {
+        size_t operator()(const ArenaString& str) const noexcept { return static_cast<size_t>(str.Hash()); }
+    };
+}
+
+
+
+#endif
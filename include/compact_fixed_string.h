@@ -0,0 +1,115 @@
+// ============================================================================
+// TextCPP - High Performance String Utility Library
+// ----------------------------------------------------------------------------
+// File:        compact_fixed_string.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+
+#ifndef __COMPACT_FIXED_STRING_H_GUARD
+#define __COMPACT_FIXED_STRING_H_GUARD
+
+#include "fixed_string.h"
+
+
+/// <summary>
+/// Buffers at or below this size are copied whole by CompactFixedString: a fixed-size copy of a few
+/// cache lines is cheaper than finding the length first. Define it before including to change it.
+/// </summary>
+#if !defined(FIXED_STRING_COMPACT_COPY_THRESHOLD)
+#define FIXED_STRING_COMPACT_COPY_THRESHOLD 64
+#endif
+
+
+/// <summary>
+/// A FixedString whose copies and moves transfer only the contents, not the whole buffer.
+/// Above FIXED_STRING_COMPACT_COPY_THRESHOLD bytes, copy construction, copy assignment and the moves
+/// (which are copies) move length() + 1 bytes, so a FixedString&lt;1024&gt; holding a short message costs a
+/// short copy when it is queued, returned or relocated by a growing std::vector.
+/// A new CompactFixedString starts empty without zeroing its buffer.
+/// Everything else is FixedString, and it binds to any FixedString&lt;N, L&gt; parameter.
+/// </summary>
+/// <remarks>
+/// Unlike FixedString it is not trivially copyable, so it has no plain-data guarantee: do not memcpy it
+/// or use SerializeArray on it. With CanonicalTail the whole buffer is always copied, since the zero tail
+/// must be kept.
+/// </remarks>
+/// <typeparam name="N">The total buffer size in bytes, including the null terminator.</typeparam>
+/// <typeparam name="L">How the length is tracked. See LengthPolicy.</typeparam>
+template<size_t N, LengthPolicy L = LengthPolicy::Scan>
+class CompactFixedString : public FixedString<N, L>
+{
+    using Base = FixedString<N, L>;
+
+    public:
+        /// <summary>
+        /// True if copies transfer only the contents.
+        /// </summary>
+        static constexpr bool CompactCopy = N > FIXED_STRING_COMPACT_COPY_THRESHOLD && !Base::CanonicalTail;
+
+        using Base::Base;
+        using Base::operator=;
+
+        /// <summary>
+        /// Constructs an empty string. Only the terminator is written.
+        /// </summary>
+        FIXED_STRING_CONSTEXPR CompactFixedString() noexcept : Base(UninitializedTag{}) {}
+
+        FIXED_STRING_CONSTEXPR CompactFixedString(const CompactFixedString& other) noexcept : Base(UninitializedTag{}) { CopyFrom(other); }
+        FIXED_STRING_CONSTEXPR CompactFixedString(CompactFixedString&& other) noexcept : Base(UninitializedTag{}) { CopyFrom(other); }
+
+        /// <summary>
+        /// Constructs from a FixedString of the same capacity and policy, copying only its contents.
+        /// </summary>
+        FIXED_STRING_CONSTEXPR CompactFixedString(const Base& other) noexcept : Base(UninitializedTag{}) { CopyFrom(other); }
+
+        FIXED_STRING_CONSTEXPR CompactFixedString& operator=(const CompactFixedString& other) noexcept { CopyFrom(other); return *this; }
+        FIXED_STRING_CONSTEXPR CompactFixedString& operator=(CompactFixedString&& other) noexcept { CopyFrom(other); return *this; }
+
+        /// <summary>
+        /// Assigns from a FixedString of the same capacity and policy, copying only its contents.
+        /// </summary>
+        FIXED_STRING_CONSTEXPR CompactFixedString& operator=(const Base& other) noexcept { CopyFrom(other); return *this; }
+
+    private:
+        FIXED_STRING_CONSTEXPR void CopyFrom(const Base& other) noexcept
+        {
+            if (this == &other) return;
+
+            if constexpr (!CompactCopy) {
+                FixedStringDetail::CopyBytes(this->Data, other.Data, N);
+            }
+            else {
+                const size_t len = other.length();
+
+                FixedStringDetail::CopyBytes(this->Data, other.Data, len);
+                this->Terminate(len);                           // A copy, not an assignment
+            }
+        }
+};
+
+
+/// <summary>
+/// std::hash specialization matching FixedString: equal contents hash equally.
+/// </summary>
+namespace std
+{
+    template<size_t N, LengthPolicy L>
+    struct hash<CompactFixedString<N, L>>
+    {
+        size_t operator()(const CompactFixedString<N, L>& str) const noexcept { return static_cast<size_t>(str.Hash()); }
+    };
+}
+
+
+
+#endif
@@ -18,13 +18,59 @@
 #ifndef __FIXED_STRING_H_GUARD
 #define __FIXED_STRING_H_GUARD
 
-#include <iostream>
 #include <cassert>
 #include <string>
 #include <string_view>
 #include <cstring>
 #include <algorithm>
+#include <functional>
+#include <new>
+#include <charconv>
+#include <optional>
+#include <cerrno>
 
+#if defined(__cpp_impl_three_way_comparison)
+#include <compare>
+#endif
+
+#include "fixed_string_config.h"
+#include "fixed_string_detail.h"
+#include "fixed_string_simd.h"
+#include "fixed_string_instrumentation.h"
+#include "fixed_string_verify.h"
+#include "string_split.h"
+
+
+/// <summary>
+/// Selects how a FixedString tracks the length of its contents.
+/// </summary>
+enum class LengthPolicy
+{
+    /// <summary>
+    /// The length is found by scanning for the null terminator. O(n). Default.
+    /// </summary>
+    Scan,
+
+    /// <summary>
+    /// The remaining capacity is stored in the last byte of the buffer, Data[N - 1].
+    /// When the string is full the remaining capacity is zero, so the byte doubles as the
+    /// null terminator. Gives O(1) length() at no storage cost. Requires N to be at most 256.
+    /// </summary>
+    Stored
+};
+
+
+/// <summary>
+/// Tag selecting the FixedString constructor that skips zeroing the buffer.
+/// </summary>
+struct UninitializedTag
+{
+    explicit constexpr UninitializedTag() = default;
+};
+
+
+inline namespace FIXED_STRING_ABI
+{
 
 /// <summary>
 /// A fixed-size string with a compile-time capacity stored inline within the object.
@@ -32,79 +78,207 @@
 /// The data's location (stack, heap, or static) matches the location of the object itself.
 /// </summary>
 /// <typeparam name="N">The total buffer size in bytes, including the null terminator.</typeparam>
-template<size_t N>
+/// <typeparam name="L">How the length is tracked. See LengthPolicy.</typeparam>
+template<size_t N, LengthPolicy L = LengthPolicy::Scan>
 class FixedString
 {
+    static_assert(L != LengthPolicy::Stored || (N > 0 && N <= 256), "FixedString: LengthPolicy::Stored requires 0 < N <= 256");
 
     public:
         /// <summary>
         /// The raw character buffer. Public to allow POD-style aggregate initialization.
         /// Always null-terminated after any Assign operation.
+        /// Writing to Data directly and ending the contents with '\0' is enough for length, comparison, hashing
+        /// and search. Call SetLength afterwards to also restore what the other members keep in sync: the stored
+        /// length with LengthPolicy::Stored, and the zero tail that CanonicalTail types rely on for their
+        /// raw-byte images (SerializeTo, SerializeArray).
         /// </summary>
         char Data[N];
 
         /// <summary>
         /// Default constructor. Zero-initializes the entire buffer.
         /// </summary>
-        FixedString() { std::memset(Data, 0, N); }
+        FIXED_STRING_CONSTEXPR FixedString() { FixedStringDetail::FillBytes(Data, '\0', N); Terminate(0); }
+
+        /// <summary>
+        /// Constructs an empty string without zeroing the buffer. Only the terminator (and, with
+        /// LengthPolicy::Stored, the length byte) is written; the rest of Data is left indeterminate.
+        /// During constant evaluation the buffer is zeroed, since constants cannot hold indeterminate bytes,
+        /// and it is always zeroed when CanonicalTail is true.
+        /// </summary>
+        FIXED_STRING_CONSTEXPR explicit FixedString(UninitializedTag)
+        {
+            if (FixedStringDetail::IsConstantEvaluated()) {
+                FixedStringDetail::FillBytes(Data, '\0', N);
+            }
+
+            Terminate(0);
+        }
+
+        /// <summary>
+        /// Returns an empty string built without zeroing the buffer. See FixedString(UninitializedTag).
+        /// </summary>
+        static FIXED_STRING_CONSTEXPR FixedString MakeEmpty() { return FixedString(UninitializedTag{}); }
+
+        /// <summary>
+        /// Constructs count empty strings in raw storage without zeroing their buffers, for bulk
+        /// reservation of record pools. Only the terminator of each element is written.
+        /// The storage must be suitably aligned and hold at least count objects.
+        /// </summary>
+        /// <param name="storage">Raw storage, for example from operator new or a pool.</param>
+        /// <param name="count">The number of strings to construct.</param>
+        /// <returns>Pointer to the first constructed string.</returns>
+        static FixedString* ConstructEmpty(void* storage, size_t count)
+        {
+            FixedString* first = static_cast<FixedString*>(storage);
+
+            for (size_t i = 0; i < count; ++i) {
+                new (static_cast<void*>(first + i)) FixedString(UninitializedTag{});
+            }
+
+            return first;
+        }
 
         /// <summary>
         /// Copy constructor. Copies the full buffer from another FixedString of the same capacity.
         /// </summary>
-        FixedString(const FixedString&) = default;
+        constexpr FixedString(const FixedString&) = default;
 
         /// <summary>
         /// Copy assignment operator. Copies the full buffer from another FixedString of the same capacity.
         /// </summary>
-        FixedString& operator=(const FixedString&) = default;
+        constexpr FixedString& operator=(const FixedString&) = default;
 
         /// <summary>
         /// Constructs a FixedString from a null-terminated C string. Null pointer is treated as empty string.
+        /// A template so that string literals and other const char arrays pick the sized array overload instead.
         /// </summary>
         /// <param name="str">The source C string. May be null.</param>
-        FixedString(const char* str) { Assign(str); }
+        template<typename T, std::enable_if_t<FixedStringDetail::IsCString<T>, int> = 0>
+        FIXED_STRING_CONSTEXPR FixedString(const T& str) { Assign(static_cast<const char*>(str)); }
+
+        /// <summary>
+        /// Constructs a FixedString from a string literal or other const char array. The contents end at
+        /// the first null, as for a C string, but the search is bounded by the array, so a field of a C
+        /// struct need not be terminated. Contents that do not fit are handled like Assign.
+        /// </summary>
+        /// <param name="str">The source array.</param>
+        template<size_t K>
+        FIXED_STRING_CONSTEXPR FixedString(const char (&str)[K]) { AssignArray(str); }
 
         /// <summary>
-        /// Constructs a FixedString from a std::string.
+        /// Constructs a FixedString from a writable char array. Like the const overload, the contents end at
+        /// the first null and the search never leaves the array.
+        /// </summary>
+        /// <param name="str">The source buffer.</param>
+        template<size_t K>
+        FIXED_STRING_CONSTEXPR FixedString(char (&str)[K]) { AssignArray(str); }
+
+        /// <summary>
+        /// Constructs a FixedString from a std::string, using its stored size instead of rescanning it.
         /// </summary>
         /// <param name="str">The source string.</param>
-        FixedString(const std::string& str) { Assign(str.c_str()); }
+        FIXED_STRING_CONSTEXPR FixedString(const std::string& str) { Assign(std::string_view(str)); }
 
         /// <summary>
         /// Constructs a FixedString from a std::string_view.
         /// </summary>
         /// <param name="sv">The source string view.</param>
-        FixedString(std::string_view sv) { Assign(sv); }
+        FIXED_STRING_CONSTEXPR FixedString(std::string_view sv) { Assign(sv); }
+
+        /// <summary>
+        /// Constructs a FixedString from a smaller or equal FixedString of any length policy. Implicit,
+        /// since the contents always fit.
+        /// </summary>
+        /// <param name="other">The source string.</param>
+        template<size_t M, LengthPolicy LM, std::enable_if_t<(M <= N) && (M != N || LM != L), int> = 0>
+        FIXED_STRING_CONSTEXPR FixedString(const FixedString<M, LM>& other) { Assign(static_cast<std::string_view>(other)); }
+
+        /// <summary>
+        /// Constructs a FixedString from a larger FixedString. Explicit, since the contents may not fit;
+        /// asserts in debug builds and truncates in release builds like Assign.
+        /// </summary>
+        /// <param name="other">The source string.</param>
+        template<size_t M, LengthPolicy LM, std::enable_if_t<(M > N), int> = 0>
+        FIXED_STRING_CONSTEXPR explicit FixedString(const FixedString<M, LM>& other) { Assign(static_cast<std::string_view>(other)); }
 
         /// <summary>
         /// Assigns from a null-terminated C string. Null pointer is treated as empty string.
         /// </summary>
         /// <param name="str">The source C string. May be null.</param>
         /// <returns>Reference to this instance.</returns>
-        FixedString& operator=(const char* str) { Assign(str); return *this; }
+        template<typename T, std::enable_if_t<FixedStringDetail::IsCString<T>, int> = 0>
+        FIXED_STRING_CONSTEXPR FixedString& operator=(const T& str) { Assign(static_cast<const char*>(str)); return *this; }
+
+        /// <summary>
+        /// Assigns from a string literal or other const char array, bounded by its size. See FixedString(const char (&amp;)[K]).
+        /// </summary>
+        /// <param name="str">The source array.</param>
+        /// <returns>Reference to this instance.</returns>
+        template<size_t K>
+        FIXED_STRING_CONSTEXPR FixedString& operator=(const char (&str)[K]) { AssignArray(str); return *this; }
 
         /// <summary>
-        /// Assigns from a std::string.
+        /// Assigns from a writable char array, bounded by its size like the const overload.
+        /// </summary>
+        /// <param name="str">The source buffer.</param>
+        /// <returns>Reference to this instance.</returns>
+        template<size_t K>
+        FIXED_STRING_CONSTEXPR FixedString& operator=(char (&str)[K]) { AssignArray(str); return *this; }
+
+        /// <summary>
+        /// Assigns from a std::string, using its stored size instead of rescanning it.
         /// </summary>
         /// <param name="str">The source string.</param>
         /// <returns>Reference to this instance.</returns>
-        FixedString& operator=(const std::string& str) { Assign(str.c_str()); return *this; }
+        FIXED_STRING_CONSTEXPR FixedString& operator=(const std::string& str) { Assign(std::string_view(str)); return *this; }
+
+        /// <summary>
+        /// Assigns from a FixedString of another capacity or length policy.
+        /// Asserts in debug builds if the contents do not fit, and truncates in release builds.
+        /// </summary>
+        /// <param name="other">The source string.</param>
+        /// <returns>Reference to this instance.</returns>
+        template<size_t M, LengthPolicy LM, std::enable_if_t<(M != N || LM != L), int> = 0>
+        FIXED_STRING_CONSTEXPR FixedString& operator=(const FixedString<M, LM>& other) { Assign(static_cast<std::string_view>(other)); return *this; }
 
         /// <summary>
         /// Assigns from a std::string_view.
         /// </summary>
         /// <param name="sv">The source string view.</param>
         /// <returns>Reference to this instance.</returns>
-        FixedString& operator=(std::string_view sv) { Assign(sv); return *this; }
+        FIXED_STRING_CONSTEXPR FixedString& operator=(std::string_view sv) { Assign(sv); return *this; }
 
         /// <summary>
-        /// Equality comparison against another FixedString of potentially different capacity.
-        /// Compares string contents, not buffer sizes.
+        /// Equality comparison against another FixedString of potentially different capacity or policy.
+        /// Compares string contents, not buffer sizes. Lengths are compared first, then the contents 8 bytes
+        /// at a time. When neither length is O(1) a single strcmp pass replaces the two length scans.
         /// </summary>
         /// <param name="other">The FixedString to compare against.</param>
         /// <returns>True if string contents are identical.</returns>
-        template<size_t M>
-        bool operator==(const FixedString<M>& other) const { return std::strcmp(Data, other.Data) == 0; }
+        template<size_t M, LengthPolicy LM>
+        FIXED_STRING_CONSTEXPR bool operator==(const FixedString<M, LM>& other) const
+        {
+            bool equal;
+
+            if constexpr (M == N && LM == L && Packed) {
+                equal = PackedCompare(other) == 0;
+            }
+            else if constexpr (ConstantTimeLength || FixedString<M, LM>::ConstantTimeLength) {
+                const size_t len = length();
+                equal = len == other.length() && FixedStringDetail::BytesEqual(Data, other.Data, len);
+            }
+            else {
+                equal = FixedStringDetail::CompareCString(Data, other.Data) == 0;
+            }
+
+#if FIXED_STRING_VERIFY_FAST_PATHS
+            if (!FixedStringDetail::IsConstantEvaluated()) {
+                FixedStringDetail::VerifyFastPath(equal == (std::string_view(Data, length()) == std::string_view(other.Data, other.length())), "operator==");
+            }
+#endif
+            return equal;
+        }
 
         /// <summary>
         /// Equality comparison against a null-terminated C string.
@@ -112,32 +286,41 @@ class FixedString
         /// </summary>
         /// <param name="other">The C string to compare against. May be null.</param>
         /// <returns>True if string contents are identical. False if other is null.</returns>
-        bool operator==(const char* other) const
+        FIXED_STRING_CONSTEXPR bool operator==(const char* other) const
         {
             if (!other) return false;
-            return std::strcmp(Data, other) == 0;
+            return FixedStringDetail::CompareCString(Data, other) == 0;
         }
 
         /// <summary>
-        /// Equality comparison against a std::string_view.
+        /// Equality comparison against a std::string_view. Lengths are compared first, then the
+        /// contents 8 bytes at a time.
         /// </summary>
         /// <param name="other">The string view to compare against.</param>
         /// <returns>True if string contents are identical.</returns>
-        bool operator==(std::string_view other) const { return std::string_view(Data) == other; }
+        FIXED_STRING_CONSTEXPR bool operator==(std::string_view other) const
+        {
+            const bool equal = length() == other.size() && FixedStringDetail::BytesEqual(Data, other.data(), other.size());
+
+#if FIXED_STRING_VERIFY_FAST_PATHS
+            if (!FixedStringDetail::IsConstantEvaluated()) FixedStringDetail::VerifyFastPath(equal == (std::string_view(Data, length()) == other), "operator==(std::string_view)");
+#endif
+            return equal;
+        }
 
         /// <summary>
         /// Inequality comparison against a null-terminated C string.
         /// </summary>
         /// <param name="other">The C string to compare against. May be null.</param>
         /// <returns>True if string contents differ, or if other is null.</returns>
-        bool operator!=(const char* other) const { return !(*this == other); }
+        FIXED_STRING_CONSTEXPR bool operator!=(const char* other) const { return !(*this == other); }
 
         /// <summary>
         /// Inequality comparison against a std::string_view.
         /// </summary>
         /// <param name="other">The string view to compare against.</param>
         /// <returns>True if string contents differ.</returns>
-        bool operator!=(std::string_view other) const { return !(*this == other); }
+        FIXED_STRING_CONSTEXPR bool operator!=(std::string_view other) const { return !(*this == other); }
 
         /// <summary>
         /// Inequality comparison against another FixedString of potentially different capacity.
@@ -145,8 +328,101 @@ class FixedString
         /// </summary>
         /// <param name="other">The FixedString to compare against.</param>
         /// <returns>True if string contents differ.</returns>
-        template<size_t M>
-        bool operator!=(const FixedString<M>& other) const { return !(*this == other); }
+        template<size_t M, LengthPolicy LM>
+        FIXED_STRING_CONSTEXPR bool operator!=(const FixedString<M, LM>& other) const { return !(*this == other); }
+
+        /// <summary>
+        /// Three-way lexicographic comparison of string contents as unsigned bytes.
+        /// A shorter string orders before a longer string it is a prefix of.
+        /// </summary>
+        /// <param name="other">The FixedString to compare against.</param>
+        /// <returns>Negative, zero or positive if this string orders before, equal to or after other.</returns>
+        template<size_t M, LengthPolicy LM>
+        FIXED_STRING_CONSTEXPR int Compare(const FixedString<M, LM>& other) const
+        {
+            int order;
+
+            if constexpr (M == N && LM == L && Packed) {
+                order = PackedCompare(other);
+            }
+            else {
+                order = FixedStringDetail::CompareStrings(Data, length(), other.Data, other.length());
+            }
+
+#if FIXED_STRING_VERIFY_FAST_PATHS
+            if (!FixedStringDetail::IsConstantEvaluated()) {
+                FixedStringDetail::VerifyFastPath(FixedStringDetail::SameOrder(order, std::string_view(Data, length()).compare(std::string_view(other.Data, other.length()))), "Compare");
+            }
+#endif
+            return order;
+        }
+
+        /// <summary>
+        /// Three-way lexicographic comparison against a std::string_view.
+        /// </summary>
+        /// <param name="other">The string view to compare against.</param>
+        /// <returns>Negative, zero or positive if this string orders before, equal to or after other.</returns>
+        FIXED_STRING_CONSTEXPR int Compare(std::string_view other) const
+        {
+            const size_t len = length();
+            const int order = FixedStringDetail::CompareStrings(Data, len, other.data(), other.size());
+
+#if FIXED_STRING_VERIFY_FAST_PATHS
+            if (!FixedStringDetail::IsConstantEvaluated()) FixedStringDetail::VerifyFastPath(FixedStringDetail::SameOrder(order, std::string_view(Data, len).compare(other)), "Compare(std::string_view)");
+#endif
+            return order;
+        }
+
+        /// <summary>
+        /// Three-way lexicographic comparison against a null-terminated C string.
+        /// A null pointer is treated as an empty string.
+        /// </summary>
+        /// <param name="other">The C string to compare against. May be null.</param>
+        /// <returns>Negative, zero or positive if this string orders before, equal to or after other.</returns>
+        FIXED_STRING_CONSTEXPR int Compare(const char* other) const { return FixedStringDetail::CompareCString(Data, other ? other : ""); }
+
+        /// <summary>
+        /// Ordering comparisons against another FixedString of potentially different capacity or policy.
+        /// Suitable as the key ordering for std::map, std::set and sorted arrays.
+        /// </summary>
+        template<size_t M, LengthPolicy LM> FIXED_STRING_CONSTEXPR bool operator<(const FixedString<M, LM>& other) const { return Compare(other) < 0; }
+        template<size_t M, LengthPolicy LM> FIXED_STRING_CONSTEXPR bool operator<=(const FixedString<M, LM>& other) const { return Compare(other) <= 0; }
+        template<size_t M, LengthPolicy LM> FIXED_STRING_CONSTEXPR bool operator>(const FixedString<M, LM>& other) const { return Compare(other) > 0; }
+        template<size_t M, LengthPolicy LM> FIXED_STRING_CONSTEXPR bool operator>=(const FixedString<M, LM>& other) const { return Compare(other) >= 0; }
+
+        /// <summary>
+        /// Ordering comparisons against a std::string_view.
+        /// </summary>
+        FIXED_STRING_CONSTEXPR bool operator<(std::string_view other) const { return Compare(other) < 0; }
+        FIXED_STRING_CONSTEXPR bool operator<=(std::string_view other) const { return Compare(other) <= 0; }
+        FIXED_STRING_CONSTEXPR bool operator>(std::string_view other) const { return Compare(other) > 0; }
+        FIXED_STRING_CONSTEXPR bool operator>=(std::string_view other) const { return Compare(other) >= 0; }
+
+        /// <summary>
+        /// Ordering comparisons against a null-terminated C string. A null pointer is treated as an empty string.
+        /// </summary>
+        FIXED_STRING_CONSTEXPR bool operator<(const char* other) const { return Compare(other) < 0; }
+        FIXED_STRING_CONSTEXPR bool operator<=(const char* other) const { return Compare(other) <= 0; }
+        FIXED_STRING_CONSTEXPR bool operator>(const char* other) const { return Compare(other) > 0; }
+        FIXED_STRING_CONSTEXPR bool operator>=(const char* other) const { return Compare(other) >= 0; }
+
+#if defined(__cpp_impl_three_way_comparison) && defined(__cpp_lib_three_way_comparison)
+        /// <summary>
+        /// C++20 three-way comparison against another FixedString. Same ordering as Compare.
+        /// </summary>
+        template<size_t M, LengthPolicy LM>
+        FIXED_STRING_CONSTEXPR std::strong_ordering operator<=>(const FixedString<M, LM>& other) const { return Compare(other) <=> 0; }
+
+        /// <summary>
+        /// C++20 three-way comparison against a std::string_view. Same ordering as Compare.
+        /// </summary>
+        FIXED_STRING_CONSTEXPR std::strong_ordering operator<=>(std::string_view other) const { return Compare(other) <=> 0; }
+
+        /// <summary>
+        /// C++20 three-way comparison against a null-terminated C string. Same ordering as Compare.
+        /// </summary>
+        FIXED_STRING_CONSTEXPR std::strong_ordering operator<=>(const char* other) const { return Compare(other) <=> 0; }
+#endif
 
 
 
@@ -159,18 +435,24 @@ class FixedString
         /// Asserts in debug builds that N is greater than zero and that the source
         /// does not exceed the buffer capacity (which would cause truncation).
         /// </remarks>
-        void Assign(std::string_view sv)
+        FIXED_STRING_CONSTEXPR void Assign(std::string_view sv)
         {
             assert(N > 0 && "FixedString capacity must be > 0");
             assert(sv.size() < N && "FixedString: input will be truncated");
 
             size_t copyLen = std::min(sv.size(), N - 1);        // Leave room for the null terminator
 
-            if (copyLen > 0) {
-                std::memcpy(Data, sv.data(), copyLen);
+            FixedStringDetail::CopyBytes(Data, sv.data(), copyLen);
+
+            if (FixedStringDetail::IsConstantEvaluated()) {                 // Constants cannot hold indeterminate bytes
+                FixedStringDetail::FillBytes(Data + copyLen, '\0', N - copyLen);
             }
-            
-            Data[copyLen] = '\0';                               // Null terminate exactly at the end of the content
+
+            Terminate(copyLen);                                 // Null terminate exactly at the end of the content
+
+#if FIXED_STRING_INSTRUMENTATION
+            if (!FixedStringDetail::IsConstantEvaluated()) FixedStringDetail::RecordAssign<N>(copyLen, sv.size() > copyLen);
+#endif
         }
 
         /// <summary>
@@ -178,29 +460,502 @@ class FixedString
         /// Guards against null pointer before delegating to the string_view overload.
         /// </summary>
         /// <param name="str">The source C string. If null, the buffer is set to empty.</param>
-        void Assign(const char* str)
+        FIXED_STRING_CONSTEXPR void Assign(const char* str)
         {
             if (!str)
             {
-                Data[0] = '\0'; return;
+                SetLength(0); return;
             }
 
             Assign(std::string_view(str));
         }
 
+        /// <summary>
+        /// Ends the string at len after its contents have been written directly into Data.
+        /// Writes the null terminator at len and, with LengthPolicy::Stored, the remaining
+        /// capacity into Data[N - 1]. When len == N - 1 both writes store zero to the same byte.
+        /// With CanonicalTail the whole tail from len is cleared instead of just the terminator.
+        /// Counts as an assignment for FIXED_STRING_INSTRUMENTATION.
+        /// </summary>
+        /// <param name="len">The new content length. Must be less than N.</param>
+        /// <param name="truncated">True if the writer had to cut its input to fit. Only read by instrumentation.</param>
+        FIXED_STRING_CONSTEXPR void SetLength(size_t len, bool truncated = false)
+        {
+            Terminate(len);
+
+#if FIXED_STRING_INSTRUMENTATION
+            if (!FixedStringDetail::IsConstantEvaluated()) FixedStringDetail::RecordAssign<N>(len, truncated);
+#else
+            (void)truncated;
+#endif
+        }
+
         /// <summary>
         /// Returns a null-terminated pointer to the internal buffer.
         /// </summary>
-        const char* c_str() const { return Data; }
+        FIXED_STRING_CONSTEXPR const char* c_str() const { return Data; }
         /// <summary>
         /// Returns true if the string is empty (first byte is null terminator).
         /// </summary>
-        bool empty() const { return Data[0] == '\0'; }
+        FIXED_STRING_CONSTEXPR bool empty() const { return Data[0] == '\0'; }
 
         /// <summary>
-        /// Returns the length of the string in characters, excluding the null terminator. O(n).
+        /// Returns the length of the string in characters, excluding the null terminator.
+        /// O(n) with LengthPolicy::Scan, O(1) with LengthPolicy::Stored.
         /// </summary>
-        size_t length() const { return std::strlen(Data); }
+        FIXED_STRING_CONSTEXPR size_t length() const
+        {
+            if constexpr (L == LengthPolicy::Stored)
+            {
+                const size_t len = (N - 1) - static_cast<unsigned char>(Data[N - 1]);
+
+#if FIXED_STRING_VERIFY_FAST_PATHS
+                if (!FixedStringDetail::IsConstantEvaluated()) FixedStringDetail::VerifyFastPath(len < N && Data[len] == '\0', "length");
+#endif
+                return len;
+            }
+            else
+            {
+                if constexpr (Packed)
+                {
+                    if (!FixedStringDetail::IsConstantEvaluated())
+                    {
+                        const size_t len = PackedLength();
+
+#if FIXED_STRING_VERIFY_FAST_PATHS
+                        FixedStringDetail::VerifyFastPath(len == std::char_traits<char>::length(Data), "length");
+#endif
+                        return len;
+                    }
+                }
+
+                return std::char_traits<char>::length(Data);
+            }
+        }
+
+        /// <summary>
+        /// Returns a fast non-cryptographic 64-bit hash of the string contents.
+        /// Equal contents hash equally across capacities, policies and std::string_view.
+        /// </summary>
+        /// <param name="seed">Optional seed.</param>
+        FIXED_STRING_CONSTEXPR uint64_t Hash(uint64_t seed = 0) const
+        {
+            const size_t len = length();
+            const uint64_t hash = FixedStringDetail::Hash64(Data, len, seed);
+
+#if FIXED_STRING_VERIFY_FAST_PATHS
+            if (!FixedStringDetail::IsConstantEvaluated())                  // Same contents at another alignment, as a view would be
+            {
+                char copy[N + 1] = {};
+                std::memcpy(copy + 1, Data, len);
+                FixedStringDetail::VerifyFastPath(hash == FixedStringDetail::Hash64(copy + 1, len, seed), "Hash");
+            }
+#endif
+            return hash;
+        }
+
+        /// <summary>
+        /// Returned by the search functions when nothing is found.
+        /// </summary>
+        static constexpr size_t npos = std::string_view::npos;
+
+        /// <summary>
+        /// Finds the first occurrence of a character at or after pos.
+        /// With LengthPolicy::Scan, strchr finds the character and the terminator in one pass, so the
+        /// length is never scanned on its own. With an O(1) length the SIMD kernels load whole blocks from
+        /// the N-byte buffer, past the terminator, without page-crossing checks.
+        /// </summary>
+        /// <param name="c">The character to find.</param>
+        /// <param name="pos">The index to start searching from.</param>
+        /// <returns>The index of the match, or npos.</returns>
+        FIXED_STRING_CONSTEXPR size_t Find(char c, size_t pos = 0) const
+        {
+            if (FixedStringDetail::IsConstantEvaluated()) return std::string_view(Data, length()).find(c, pos);
+
+            size_t result = npos;
+
+            if constexpr (ConstantTimeLength)
+            {
+                const size_t len = length();
+
+                if (pos < len)
+                {
+                    const size_t at = FixedStringDetail::FindChar(Data + pos, len - pos, c, N - pos);
+                    result = at == npos ? npos : at + pos;
+                }
+            }
+            else if (c != '\0' && pos < N && !std::memchr(Data, '\0', pos))     // The contents hold no null; pos must not pass the terminator
+            {
+                const char* hit = std::strchr(Data + pos, c);
+                result = hit ? static_cast<size_t>(hit - Data) : npos;
+            }
+
+#if FIXED_STRING_VERIFY_FAST_PATHS
+            FixedStringDetail::VerifyFastPath(result == std::string_view(Data, length()).find(c, pos), "Find(char)");
+#endif
+            return result;
+        }
+
+        /// <summary>
+        /// Finds the first occurrence of a substring at or after pos.
+        /// </summary>
+        /// <param name="sv">The substring to find. An empty substring matches at pos.</param>
+        /// <param name="pos">The index to start searching from.</param>
+        /// <returns>The index of the match, or npos.</returns>
+        FIXED_STRING_CONSTEXPR size_t Find(std::string_view sv, size_t pos = 0) const
+        {
+            const size_t len = length();
+
+            if (FixedStringDetail::IsConstantEvaluated()) return std::string_view(Data, len).find(sv, pos);
+            if (pos > len) return npos;
+
+            const size_t at = FixedStringDetail::FindString(Data + pos, len - pos, sv.data(), sv.size(), N - pos);
+            const size_t result = at == npos ? npos : at + pos;
+
+#if FIXED_STRING_VERIFY_FAST_PATHS
+            FixedStringDetail::VerifyFastPath(result == std::string_view(Data, len).find(sv, pos), "Find(std::string_view)");
+#endif
+            return result;
+        }
+
+        /// <summary>
+        /// Finds the last occurrence of a character at or before pos.
+        /// </summary>
+        /// <param name="c">The character to find.</param>
+        /// <param name="pos">The last index to consider. Defaults to the whole string.</param>
+        /// <returns>The index of the match, or npos.</returns>
+        FIXED_STRING_CONSTEXPR size_t RFind(char c, size_t pos = npos) const
+        {
+            const size_t len = length();
+
+            if (FixedStringDetail::IsConstantEvaluated()) return std::string_view(Data, len).rfind(c, pos);
+
+            const size_t result = FixedStringDetail::RFindChar(Data, pos < len ? pos + 1 : len, c);
+
+#if FIXED_STRING_VERIFY_FAST_PATHS
+            FixedStringDetail::VerifyFastPath(result == std::string_view(Data, len).rfind(c, pos), "RFind(char)");
+#endif
+            return result;
+        }
+
+        /// <summary>
+        /// Finds the last occurrence of a substring starting at or before pos.
+        /// </summary>
+        /// <param name="sv">The substring to find.</param>
+        /// <param name="pos">The last start index to consider. Defaults to the whole string.</param>
+        /// <returns>The index of the match, or npos.</returns>
+        FIXED_STRING_CONSTEXPR size_t RFind(std::string_view sv, size_t pos = npos) const { return std::string_view(Data, length()).rfind(sv, pos); }
+
+        /// <summary>
+        /// Finds the first character at or after pos that is any of the characters in set.
+        /// Sets of up to four characters are matched a block at a time.
+        /// </summary>
+        /// <param name="set">The characters to look for.</param>
+        /// <param name="pos">The index to start searching from.</param>
+        /// <returns>The index of the match, or npos.</returns>
+        FIXED_STRING_CONSTEXPR size_t FindFirstOf(std::string_view set, size_t pos = 0) const
+        {
+            const size_t len = length();
+
+            if (FixedStringDetail::IsConstantEvaluated()) return std::string_view(Data, len).find_first_of(set, pos);
+            if (pos >= len) return npos;
+
+            const size_t at = FixedStringDetail::FindFirstOf(Data + pos, len - pos, set, N - pos);
+            const size_t result = at == npos ? npos : at + pos;
+
+#if FIXED_STRING_VERIFY_FAST_PATHS
+            FixedStringDetail::VerifyFastPath(result == std::string_view(Data, len).find_first_of(set, pos), "FindFirstOf");
+#endif
+            return result;
+        }
+
+        /// <summary>
+        /// Finds the first character at or after pos that is none of the characters in set.
+        /// </summary>
+        /// <param name="set">The characters to skip.</param>
+        /// <param name="pos">The index to start searching from.</param>
+        /// <returns>The index of the match, or npos.</returns>
+        FIXED_STRING_CONSTEXPR size_t FindFirstNotOf(std::string_view set, size_t pos = 0) const
+        {
+            const size_t len = length();
+
+            if (FixedStringDetail::IsConstantEvaluated()) return std::string_view(Data, len).find_first_not_of(set, pos);
+            if (pos >= len) return npos;
+
+            const size_t at = FixedStringDetail::FindFirstNotOf(Data + pos, len - pos, set, N - pos);
+            const size_t result = at == npos ? npos : at + pos;
+
+#if FIXED_STRING_VERIFY_FAST_PATHS
+            FixedStringDetail::VerifyFastPath(result == std::string_view(Data, len).find_first_not_of(set, pos), "FindFirstNotOf");
+#endif
+            return result;
+        }
+
+        /// <summary>
+        /// Returns true if the string contains the character.
+        /// </summary>
+        FIXED_STRING_CONSTEXPR bool Contains(char c) const { return Find(c) != npos; }
+
+        /// <summary>
+        /// Returns true if the string contains the substring.
+        /// </summary>
+        FIXED_STRING_CONSTEXPR bool Contains(std::string_view sv) const { return Find(sv) != npos; }
+
+        /// <summary>
+        /// Returns true if the string begins with the prefix.
+        /// </summary>
+        FIXED_STRING_CONSTEXPR bool StartsWith(std::string_view prefix) const
+        {
+            return prefix.size() <= length() && FixedStringDetail::BytesEqual(Data, prefix.data(), prefix.size());
+        }
+
+        /// <summary>
+        /// Returns true if the string begins with the character.
+        /// </summary>
+        FIXED_STRING_CONSTEXPR bool StartsWith(char c) const { return Data[0] == c && c != '\0'; }
+
+        /// <summary>
+        /// Returns true if the string ends with the suffix.
+        /// </summary>
+        FIXED_STRING_CONSTEXPR bool EndsWith(std::string_view suffix) const
+        {
+            const size_t len = length();
+            return suffix.size() <= len && FixedStringDetail::BytesEqual(Data + len - suffix.size(), suffix.data(), suffix.size());
+        }
+
+        /// <summary>
+        /// Returns true if the string ends with the character.
+        /// </summary>
+        FIXED_STRING_CONSTEXPR bool EndsWith(char c) const
+        {
+            const size_t len = length();
+            return len > 0 && Data[len - 1] == c;
+        }
+
+        /// <summary>
+        /// Returns a lazy range of the tokens between occurrences of a delimiter character.
+        /// Tokens are std::string_view into this string, which must outlive the range and stay unmodified.
+        /// </summary>
+        /// <param name="delimiter">The delimiter.</param>
+        /// <param name="skipEmpty">If true, empty tokens are not yielded.</param>
+        SplitRange<SplitByChar> Split(char delimiter, bool skipEmpty = false) const
+        {
+            return SplitRange<SplitByChar>(std::string_view(Data, length()), SplitByChar{ delimiter }, skipEmpty, N);
+        }
+
+        /// <summary>
+        /// Returns a lazy range of the tokens between occurrences of a multi-character delimiter.
+        /// </summary>
+        /// <param name="delimiter">The delimiter. An empty delimiter never matches.</param>
+        /// <param name="skipEmpty">If true, empty tokens are not yielded.</param>
+        SplitRange<SplitByString> Split(std::string_view delimiter, bool skipEmpty = false) const
+        {
+            return SplitRange<SplitByString>(std::string_view(Data, length()), SplitByString{ delimiter }, skipEmpty, N);
+        }
+
+        /// <summary>
+        /// Returns a lazy range of the tokens between any of a set of delimiter characters. Use SplitAnyOf to build the set.
+        /// </summary>
+        /// <param name="delimiters">The delimiter set.</param>
+        /// <param name="skipEmpty">If true, empty tokens are not yielded.</param>
+        SplitRange<SplitByAnyOf> Split(SplitByAnyOf delimiters, bool skipEmpty = false) const
+        {
+            return SplitRange<SplitByAnyOf>(std::string_view(Data, length()), delimiters, skipEmpty, N);
+        }
+
+        /// <summary>
+        /// The characters removed by the Trim family when no set is given: space, tab, CR, LF, FF and VT.
+        /// </summary>
+        static constexpr std::string_view Whitespace = " \t\r\n\f\v";
+
+        /// <summary>
+        /// Removes leading characters in set, in place. The remaining contents are moved down with one memmove.
+        /// </summary>
+        /// <param name="set">The characters to remove. Defaults to ASCII whitespace.</param>
+        FIXED_STRING_CONSTEXPR void TrimLeft(std::string_view set = Whitespace)
+        {
+            const size_t len = length();
+            const size_t first = FindFirstNotOf(set);
+
+            if (first == 0) return;
+            if (first >= len) { Terminate(0); return; }         // Also npos
+
+            FixedStringDetail::MoveBytesDown(Data, Data + first, len - first);
+            Terminate(len - first);
+        }
+
+        /// <summary>
+        /// Removes trailing characters in set, in place. Only the new terminator is written.
+        /// </summary>
+        /// <param name="set">The characters to remove. Defaults to ASCII whitespace.</param>
+        FIXED_STRING_CONSTEXPR void TrimRight(std::string_view set = Whitespace)
+        {
+            const size_t last = std::string_view(Data, length()).find_last_not_of(set);
+            Terminate(last == npos ? 0 : last + 1);
+        }
+
+        /// <summary>
+        /// Removes leading and trailing characters in set, in place.
+        /// </summary>
+        /// <param name="set">The characters to remove. Defaults to ASCII whitespace.</param>
+        FIXED_STRING_CONSTEXPR void Trim(std::string_view set = Whitespace)
+        {
+            TrimRight(set);                                     // Trimming the end first shortens the move
+            TrimLeft(set);
+        }
+
+        /// <summary>
+        /// Converts ASCII letters to lower case in place, a SIMD block at a time. Other bytes are unchanged.
+        /// </summary>
+        FIXED_STRING_CONSTEXPR void ToLowerAscii() { CaseMap<false>(); }
+
+        /// <summary>
+        /// Converts ASCII letters to upper case in place, a SIMD block at a time. Other bytes are unchanged.
+        /// </summary>
+        FIXED_STRING_CONSTEXPR void ToUpperAscii() { CaseMap<true>(); }
+
+        /// <summary>
+        /// Replaces every occurrence of one character with another, in place.
+        /// </summary>
+        /// <param name="from">The character to replace.</param>
+        /// <param name="to">The replacement. Must not be the null character; use Truncate to shorten the string.</param>
+        FIXED_STRING_CONSTEXPR void Replace(char from, char to)
+        {
+            assert(to != '\0' && "FixedString: Replace cannot write the null terminator");
+
+            const size_t len = length();
+
+            if (FixedStringDetail::IsConstantEvaluated())
+            {
+                for (size_t i = 0; i < len; ++i) { if (Data[i] == from) Data[i] = to; }
+                return;
+            }
+
+            FixedStringDetail::ReplaceChar(Data, len, from, to);
+        }
+
+        /// <summary>
+        /// Shortens the string to at most len characters. Does nothing if it is already that short.
+        /// </summary>
+        /// <param name="len">The maximum length to keep.</param>
+        FIXED_STRING_CONSTEXPR void Truncate(size_t len)
+        {
+            if (len < length()) Terminate(len);
+        }
+
+        /// <summary>
+        /// Parses the whole string as an integer, reading the inline buffer directly. Base-10 fields of up
+        /// to 16 digits take an 8-byte SWAR path; everything else goes through std::from_chars.
+        /// </summary>
+        /// <typeparam name="T">The integer type.</typeparam>
+        /// <param name="base">The radix, 2 to 36.</param>
+        /// <returns>The value, or std::nullopt if the string is empty, has any other characters or is out of range for T.</returns>
+        template<typename T>
+        std::optional<T> ParseInt(int base = 10) const
+        {
+            static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>, "FixedString: ParseInt requires an integer type");
+
+            T value{};
+            const size_t len = length();
+
+            if (base == 10 && FixedStringDetail::ParseDecimalSwar(Data, len, value)) return value;
+
+            const std::from_chars_result result = std::from_chars(Data, Data + len, value, base);
+            if (result.ec != std::errc() || result.ptr != Data + len) return std::nullopt;
+
+            return value;
+        }
+
+        /// <summary>
+        /// Parses the whole string as a double with std::from_chars (decimal or scientific, no leading '+' or whitespace).
+        /// </summary>
+        /// <returns>The value, or std::nullopt if the string is empty, has any other characters or is out of range.</returns>
+        std::optional<double> ParseDouble() const
+        {
+            double value = 0;
+            const size_t len = length();
+
+            const std::from_chars_result result = ParseNumber(value);
+            if (result.ec != std::errc() || result.ptr != Data + len) return std::nullopt;
+
+            return value;
+        }
+
+        /// <summary>
+        /// Parses a number from the start of the string with std::from_chars semantics, so the result tells
+        /// how much was consumed and why parsing stopped. Integer fields of up to 16 digits take the SWAR path.
+        /// Without floating-point std::from_chars, floats go through FixedStringDetail::ParseFloat, which
+        /// accepts the same syntax and uses strtof, strtod or strtold for T, so results do not change, except
+        /// that a number of FixedStringDetail::MaxFloatText (128) characters or more is rejected rather than
+        /// copied to the heap.
+        /// </summary>
+        /// <param name="value">Receives the value. Unchanged on failure.</param>
+        /// <returns>The std::from_chars result over [c_str(), c_str() + length()).</returns>
+        template<typename T>
+        std::from_chars_result ParseNumber(T& value) const
+        {
+            static_assert((std::is_integral_v<T> && !std::is_same_v<T, bool>) || std::is_floating_point_v<T>, "FixedString: ParseNumber requires an integer or floating-point type");
+
+            const size_t len = length();
+
+            if constexpr (std::is_integral_v<T>)
+            {
+                if (FixedStringDetail::ParseDecimalSwar(Data, len, value)) return { Data + len, std::errc() };
+                return std::from_chars(Data, Data + len, value);
+            }
+            else
+            {
+#if FIXED_STRING_FLOAT_TO_CHARS
+                return std::from_chars(Data, Data + len, value);
+#else
+                return FixedStringDetail::ParseFloat(Data, Data + len, value);
+#endif
+            }
+        }
+
+        /// <summary>
+        /// Replaces the contents with the decimal form of a number, written by std::to_chars straight into Data.
+        /// Floating-point values use the shortest form that round-trips.
+        /// </summary>
+        /// <param name="value">An integer or floating-point value.</param>
+        /// <returns>True on success. False if the text does not fit, in which case the string is left empty.</returns>
+        template<typename T>
+        bool AssignNumber(T value)
+        {
+            static_assert((std::is_integral_v<T> && !std::is_same_v<T, bool>) || std::is_floating_point_v<T>, "FixedString: AssignNumber requires an integer or floating-point type");
+
+            if constexpr (std::is_integral_v<T>) {
+                return FinishNumber(std::to_chars(Data, Data + (N - 1), value));
+            }
+            else
+            {
+#if FIXED_STRING_FLOAT_TO_CHARS
+                return FinishNumber(std::to_chars(Data, Data + (N - 1), value));
+#else
+                return FinishNumber(FixedStringDetail::PrintShortest(Data, N, value));
+#endif
+            }
+        }
+
+        /// <summary>
+        /// Replaces the contents with a floating-point value in the given notation and precision.
+        /// </summary>
+        /// <param name="value">The value.</param>
+        /// <param name="format">std::chars_format::fixed, scientific or general.</param>
+        /// <param name="precision">Digits after the decimal point (fixed, scientific) or significant digits (general).</param>
+        /// <returns>True on success. False if the text does not fit, in which case the string is left empty.</returns>
+        template<typename T>
+        bool AssignNumber(T value, std::chars_format format, int precision)
+        {
+            static_assert(std::is_floating_point_v<T>, "FixedString: formatted AssignNumber requires a floating-point type");
+
+#if FIXED_STRING_FLOAT_TO_CHARS
+            return FinishNumber(std::to_chars(Data, Data + (N - 1), value, format, precision));
+#else
+            const char* spec = format == std::chars_format::fixed ? "%.*f" : format == std::chars_format::scientific ? "%.*e" : "%.*g";
+            return FinishNumber(std::snprintf(Data, N, spec, precision, static_cast<double>(value)));
+#endif
+        }
 
         /// <summary>
         /// The total buffer capacity in bytes, including space for the null terminator.
@@ -208,15 +963,127 @@ class FixedString
         /// </summary>
         static constexpr size_t Capacity = N;
 
+        /// <summary>
+        /// The length tracking policy of this type.
+        /// </summary>
+        static constexpr LengthPolicy Policy = L;
+
+        /// <summary>
+        /// True for the register-sized capacities, 8 and 16 bytes. Equality and ordering against the same
+        /// type are one or two 64-bit compares of the words masked at the terminator, and length() is a
+        /// SWAR zero-byte search. These also keep every byte past the contents zero (SetLength clears the tail).
+        /// </summary>
+        static constexpr bool Packed = N == 8 || N == 16;
+
+        /// <summary>
+        /// True if length() costs O(1): a stored length, or the one- or two-word search of a Packed type.
+        /// Equality compares lengths first when either side has this.
+        /// </summary>
+        static constexpr bool ConstantTimeLength = L == LengthPolicy::Stored || Packed;
+
+        /// <summary>
+        /// True if every byte past the contents is kept zero, so the whole buffer is a function of the contents.
+        /// Always true for Packed capacities, and for all capacities when FIXED_STRING_CANONICAL_TAIL is 1.
+        /// </summary>
+        static constexpr bool CanonicalTail = Packed || FIXED_STRING_CANONICAL_TAIL;
+
+        /// <summary>
+        /// Writes the canonical N-byte image of this string to out: the contents, zeros to the end of the
+        /// buffer and, with LengthPolicy::Stored, the length byte. The image does not depend on stale bytes
+        /// left past the terminator, so snapshots are deterministic. ViewFrom maps it back without copying.
+        /// </summary>
+        /// <param name="out">Destination of at least sizeof(FixedString) == N bytes, any alignment.</param>
+        /// <returns>The number of bytes written, N.</returns>
+        size_t SerializeTo(void* out) const
+        {
+            static_assert(std::is_trivially_copyable_v<FixedString> && std::is_standard_layout_v<FixedString> && sizeof(FixedString) == N, "FixedString: layout is not plain data");
+
+            char* bytes = static_cast<char*>(out);
+
+            if constexpr (CanonicalTail) {
+                std::memcpy(bytes, Data, N);                    // Already canonical
+            }
+            else
+            {
+                const size_t len = length();
+
+                std::memcpy(bytes, Data, len);
+                std::memset(bytes + len, 0, N - len);
+
+                if constexpr (L == LengthPolicy::Stored) {
+                    bytes[N - 1] = Data[N - 1];
+                }
+            }
+
+            return N;
+        }
+
+        /// <summary>
+        /// Writes the canonical images of count strings back to back, for bulk snapshots.
+        /// One memcpy when CanonicalTail is true, otherwise one image per string.
+        /// </summary>
+        /// <param name="out">Destination of at least count * N bytes.</param>
+        /// <param name="items">The strings.</param>
+        /// <param name="count">The number of strings.</param>
+        /// <returns>The number of bytes written.</returns>
+        static size_t SerializeArray(void* out, const FixedString* items, size_t count)
+        {
+            if constexpr (CanonicalTail)
+            {
+                if (count > 0) std::memcpy(out, static_cast<const void*>(items), count * N);
+            }
+            else
+            {
+                char* bytes = static_cast<char*>(out);
+                for (size_t i = 0; i < count; ++i) bytes += items[i].SerializeTo(bytes);
+            }
+
+            return count * N;
+        }
+
+        /// <summary>
+        /// True if bytes holds a well-formed N-byte FixedString image: a terminator within the buffer and,
+        /// with LengthPolicy::Stored, a length byte that agrees with it. Check untrusted snapshots with
+        /// this before calling ViewFrom.
+        /// </summary>
+        static bool IsValidImage(const void* bytes)
+        {
+            const char* p = static_cast<const char*>(bytes);
+
+            if constexpr (L == LengthPolicy::Stored)
+            {
+                const size_t remaining = static_cast<unsigned char>(p[N - 1]);
+                return remaining <= N - 1 && p[(N - 1) - remaining] == '\0' && std::memchr(p, '\0', (N - 1) - remaining) == nullptr;
+            }
+            else {
+                return std::memchr(p, '\0', N) != nullptr;
+            }
+        }
+
+        /// <summary>
+        /// Views serialized or memory-mapped FixedString images in place, without copying. Because FixedString
+        /// is trivially copyable, standard-layout, exactly N bytes and byte-aligned, the images are the
+        /// objects. The result indexes like an array for consecutive images.
+        /// </summary>
+        /// <param name="bytes">The first image, for example a pointer into an mmap'd snapshot file.</param>
+        /// <returns>The string at bytes. Valid as long as the underlying memory.</returns>
+        static const FixedString* ViewFrom(const void* bytes)
+        {
+            static_assert(std::is_trivially_copyable_v<FixedString> && std::is_standard_layout_v<FixedString> && sizeof(FixedString) == N && alignof(FixedString) == 1, "FixedString: layout is not plain data");
+
+            assert(IsValidImage(bytes) && "FixedString: ViewFrom of a malformed image");
+            return std::launder(static_cast<const FixedString*>(bytes));
+        }
+
         /// <summary>
         /// Implicit conversion to std::string_view. Does not allocate.
         /// </summary>
-        operator std::string_view() const { return std::string_view(Data); }
+        FIXED_STRING_CONSTEXPR operator std::string_view() const { return std::string_view(Data, length()); }
 
         /// <summary>
         /// Implicit conversion to const char*. Returns a pointer to the internal buffer.
         /// </summary>
-        operator const char* () const { return Data; }
+        FIXED_STRING_CONSTEXPR operator const char* () const { return Data; }
 
         /// <summary>
         /// Explicitly converts the FixedString to a std::string, allocating a new string
@@ -224,16 +1091,7 @@ class FixedString
         /// where possible to avoid unnecessary allocation.
         /// </summary>
         /// <returns>A new std::string containing the string contents.</returns>
-        std::string ToString() const { return std::string(Data); }
-
-
-        /// <summary>
-        /// Stream output operator. Writes the string contents to the output stream.
-        /// </summary>
-        /// <param name="os">The output stream.</param>
-        /// <param name="fs">The FixedString to write.</param>
-        /// <returns>Reference to the output stream.</returns>
-        friend std::ostream& operator<<(std::ostream& os, const FixedString& fs) { return os << fs.Data; }
+        std::string ToString() const { return std::string(Data, length()); }
 
         /// <summary>
         /// Concatenates a std::string_view with a FixedString.
@@ -243,7 +1101,7 @@ class FixedString
         /// <param name="lhs">The left-hand string view.</param>
         /// <param name="rhs">The right-hand FixedString.</param>
         /// <returns>A new std::string containing the concatenated result.</returns>
-        friend std::string operator+(std::string_view lhs, const FixedString& rhs) { return std::string(lhs) + rhs.Data; }
+        friend std::string operator+(std::string_view lhs, const FixedString& rhs) { return Concatenate(lhs, rhs); }
 
         /// <summary>
         /// Concatenates a FixedString with a std::string_view.
@@ -253,7 +1111,7 @@ class FixedString
         /// <param name="lhs">The left-hand FixedString.</param>
         /// <param name="rhs">The right-hand string view.</param>
         /// <returns>A new std::string containing the concatenated result.</returns>
-        friend std::string operator+(const FixedString& lhs, std::string_view rhs) { return std::string(lhs.Data) + std::string(rhs); }
+        friend std::string operator+(const FixedString& lhs, std::string_view rhs) { return Concatenate(lhs, rhs); }
 
         /// <summary>
         /// Concatenates a FixedString with a null-terminated C string.
@@ -263,7 +1121,7 @@ class FixedString
         /// <param name="lhs">The left-hand FixedString.</param>
         /// <param name="rhs">The right-hand C string. May be null.</param>
         /// <returns>A new std::string containing the concatenated result.</returns>
-        friend std::string operator+(const FixedString& lhs, const char* rhs) { return std::string(lhs.Data) + (rhs ? rhs : ""); }
+        friend std::string operator+(const FixedString& lhs, const char* rhs) { return Concatenate(lhs, rhs ? rhs : ""); }
 
         /// <summary>
         /// Concatenates a null-terminated C string with a FixedString.
@@ -273,7 +1131,7 @@ class FixedString
         /// <param name="lhs">The left-hand C string. May be null.</param>
         /// <param name="rhs">The right-hand FixedString.</param>
         /// <returns>A new std::string containing the concatenated result.</returns>
-        friend std::string operator+(const char* lhs, const FixedString& rhs) { return std::string(lhs ? lhs : "") + rhs.Data; }
+        friend std::string operator+(const char* lhs, const FixedString& rhs) { return Concatenate(lhs ? lhs : "", rhs); }
 
         /// <summary>
         /// Concatenates two FixedStrings of potentially different capacities.
@@ -283,10 +1141,277 @@ class FixedString
         /// <param name="lhs">The left-hand FixedString.</param>
         /// <param name="rhs">The right-hand FixedString of potentially different capacity.</param>
         /// <returns>A new std::string containing the concatenated result.</returns>
-        template<size_t M>
-        friend std::string operator+(const FixedString& lhs, const FixedString<M>& rhs) { return std::string(lhs.Data) + rhs.Data; }
+        template<size_t M, LengthPolicy LM>
+        friend std::string operator+(const FixedString& lhs, const FixedString<M, LM>& rhs) { return Concatenate(lhs, rhs); }
+
+    protected:
+        /// <summary>
+        /// SetLength without the instrumentation record, for construction and in-place edits such as
+        /// Trim and Truncate, which are not assignments.
+        /// </summary>
+        FIXED_STRING_CONSTEXPR void Terminate(size_t len)
+        {
+            assert(len < N && "FixedString: length exceeds capacity");
+
+            if constexpr (CanonicalTail) {
+                FixedStringDetail::FillBytes(Data + len, '\0', N - len);
+            }
+            else if constexpr (N == 1) {
+                Data[0] = '\0';                                 // The only valid length is 0; keeps Data[len] provably in bounds
+            }
+            else {
+                Data[len] = '\0';
+            }
+
+            if constexpr (L == LengthPolicy::Stored) {
+                Data[N - 1] = static_cast<char>((N - 1) - len);
+            }
+        }
+
+    private:
+        /// <summary>
+        /// Shared body of the operator+ overloads. Reserves the combined length before copying, so the
+        /// result is built with at most one allocation, and none when it fits the small-string buffer.
+        /// </summary>
+        static std::string Concatenate(std::string_view lhs, std::string_view rhs)
+        {
+            std::string out;
+            out.reserve(lhs.size() + rhs.size());
+            out.append(lhs);
+            out.append(rhs);
+            return out;
+        }
+
+        /// <summary>
+        /// Assignment from a const char array: the contents run to the first null within the array. The
+        /// search stops after N bytes, since anything longer is cut to N - 1 by Assign anyway.
+        /// </summary>
+        template<size_t K>
+        FIXED_STRING_CONSTEXPR void AssignArray(const char (&str)[K])
+        {
+            Assign(std::string_view(str, FixedStringDetail::BoundedLength(str, std::min(K, N))));
+        }
+
+        /// <summary>
+        /// Finds the terminator of a Packed type with one or two SWAR zero-byte tests.
+        /// </summary>
+        size_t PackedLength() const
+        {
+            const uint64_t low = FixedStringDetail::ZeroBytes64(FixedStringDetail::LoadLittle64(Data));
+            if (low) return FixedStringDetail::LowestBit(low) / 8;
+
+            if constexpr (N == 16)
+            {
+                const uint64_t high = FixedStringDetail::ZeroBytes64(FixedStringDetail::LoadLittle64(Data + 8));
+                if (high) return 8 + FixedStringDetail::LowestBit(high) / 8;
+            }
+
+            return std::char_traits<char>::length(Data);
+        }
+
+        /// <summary>
+        /// Loads the word of Data at offset with every byte from the terminator on cleared, first byte least
+        /// significant. ended is set if the terminator is in this word.
+        /// </summary>
+        static uint64_t ContentWord(const char* p, bool& ended)
+        {
+            const uint64_t word = FixedStringDetail::LoadLittle64(p);
+            const uint64_t zeros = FixedStringDetail::ZeroBytes64(word);
+
+            ended = zeros != 0;
+            return ended ? word & FixedStringDetail::LowBits(FixedStringDetail::LowestBit(zeros) - 7) : word;
+        }
+
+        /// <summary>
+        /// Three-way compare for Packed types in one or two words. Each word is masked at the terminator,
+        /// so stale bytes past it, left by writing Data directly, never affect the result. Zero-padded
+        /// contents compared most significant byte first order exactly like the contents.
+        /// </summary>
+        FIXED_STRING_CONSTEXPR int PackedCompare(const FixedString& other) const
+        {
+            if (FixedStringDetail::IsConstantEvaluated()) {
+                return FixedStringDetail::CompareStrings(Data, length(), other.Data, other.length());
+            }
+
+            bool ended, otherEnded;
+            const uint64_t a = ContentWord(Data, ended);
+            const uint64_t b = ContentWord(other.Data, otherEnded);
+
+            if (a != b) return FixedStringDetail::ByteSwap64(a) < FixedStringDetail::ByteSwap64(b) ? -1 : 1;
+
+            if constexpr (N == 16)
+            {
+                if (ended) return 0;                            // Equal words end at the same byte
+
+                const uint64_t c = ContentWord(Data + 8, ended);
+                const uint64_t d = ContentWord(other.Data + 8, otherEnded);
+
+                if (c != d) return FixedStringDetail::ByteSwap64(c) < FixedStringDetail::ByteSwap64(d) ? -1 : 1;
+            }
+
+            return 0;
+        }
+
+        /// <summary>
+        /// Ends the string after a std::to_chars write into Data, or empties it if the write did not fit.
+        /// </summary>
+        bool FinishNumber(std::to_chars_result result)
+        {
+            if (result.ec != std::errc()) { SetLength(0, true); return false; }
+
+            SetLength(static_cast<size_t>(result.ptr - Data));
+            return true;
+        }
+
+        /// <summary>
+        /// Ends the string after an snprintf write into Data, or empties it if the write did not fit.
+        /// </summary>
+        bool FinishNumber(int written)
+        {
+            if (written < 0 || static_cast<size_t>(written) >= N) { SetLength(0, written >= 0); return false; }
+
+            SetLength(static_cast<size_t>(written));
+            return true;
+        }
+
+        /// <summary>
+        /// Shared body of ToLowerAscii and ToUpperAscii. Only [0, length()) is rewritten, so the
+        /// terminator and the stored length byte are never touched.
+        /// </summary>
+        template<bool Upper>
+        FIXED_STRING_CONSTEXPR void CaseMap()
+        {
+            const size_t len = length();
+
+            if (FixedStringDetail::IsConstantEvaluated())
+            {
+                for (size_t i = 0; i < len; ++i)
+                {
+                    const char c = Data[i];
+                    if (Upper ? (c >= 'a' && c <= 'z') : (c >= 'A' && c <= 'Z')) Data[i] = static_cast<char>(c ^ 0x20);
+                }
+                return;
+            }
+
+            FixedStringDetail::CaseMapAscii<Upper>(Data, len);
+        }
 };
 
+}
+
+
+// FixedString is plain data: records holding it can be copied with memcpy, written to disk and mapped back.
+static_assert(std::is_trivially_copyable_v<FixedString<32>> && std::is_trivially_copyable_v<FixedString<32, LengthPolicy::Stored>>, "FixedString must be trivially copyable");
+static_assert(std::is_standard_layout_v<FixedString<32>> && std::is_standard_layout_v<FixedString<32, LengthPolicy::Stored>>, "FixedString must be standard-layout");
+static_assert(sizeof(FixedString<13>) == 13 && alignof(FixedString<13>) == 1, "FixedString must be exactly its buffer");
+
+
+namespace FixedStringDetail
+{
+    template<typename T>
+    struct IsFixedString : std::false_type {};
+
+    template<size_t N, LengthPolicy L>
+    struct IsFixedString<FixedString<N, L>> : std::true_type {};
+
+    /// <summary>
+    /// The contents of any key type the transparent functors accept. A null C string is empty.
+    /// </summary>
+    template<size_t N, LengthPolicy L>
+    FIXED_STRING_CONSTEXPR std::string_view KeyView(const FixedString<N, L>& key) { return key; }
+
+    constexpr std::string_view KeyView(std::string_view key) { return key; }
+
+    constexpr std::string_view KeyView(const char* key) { return key ? std::string_view(key) : std::string_view(); }
+}
+
+
+/// <summary>
+/// Transparent hash for containers keyed by FixedString. Hashes FixedString of any capacity or policy,
+/// std::string_view, std::string and C strings with FixedString::Hash, so equal contents hash equally
+/// whatever their type and a lookup never has to build a temporary FixedString.
+/// </summary>
+/// <example>std::unordered_map&lt;FixedString&lt;32&gt;, Route, FixedStringHash, FixedStringEqual&gt; routes; routes.find(std::string_view(name));</example>
+/// <remarks>Heterogeneous find, count and contains on unordered containers need C++20.</remarks>
+struct FixedStringHash
+{
+    using is_transparent = void;
+
+    template<typename T>
+    FIXED_STRING_CONSTEXPR size_t operator()(const T& key) const noexcept
+    {
+        const std::string_view view = FixedStringDetail::KeyView(key);
+        return static_cast<size_t>(FixedStringDetail::Hash64(view.data(), view.size()));
+    }
+};
+
+/// <summary>
+/// Transparent equality to pair with FixedStringHash. A FixedString on either side uses FixedString's
+/// own operator==, including the whole-word compare for equal Packed types. A null C string equals "",
+/// matching its hash.
+/// </summary>
+struct FixedStringEqual
+{
+    using is_transparent = void;
+
+    template<typename A, typename B>
+    FIXED_STRING_CONSTEXPR bool operator()(const A& a, const B& b) const noexcept
+    {
+        if constexpr (FixedStringDetail::IsFixedString<A>::value && FixedStringDetail::IsFixedString<B>::value) {
+            return a == b;
+        }
+        else if constexpr (FixedStringDetail::IsFixedString<A>::value) {
+            return a == FixedStringDetail::KeyView(b);
+        }
+        else if constexpr (FixedStringDetail::IsFixedString<B>::value) {
+            return b == FixedStringDetail::KeyView(a);
+        }
+        else {
+            return FixedStringDetail::KeyView(a) == FixedStringDetail::KeyView(b);
+        }
+    }
+};
+
+/// <summary>
+/// Transparent ordering for std::map and std::set keyed by FixedString, usable with string_view and C string probes in C++17.
+/// Orders exactly like FixedString::Compare.
+/// </summary>
+struct FixedStringLess
+{
+    using is_transparent = void;
+
+    template<typename A, typename B>
+    FIXED_STRING_CONSTEXPR bool operator()(const A& a, const B& b) const noexcept
+    {
+        if constexpr (FixedStringDetail::IsFixedString<A>::value && FixedStringDetail::IsFixedString<B>::value) {
+            return a.Compare(b) < 0;
+        }
+        else if constexpr (FixedStringDetail::IsFixedString<A>::value) {
+            return a.Compare(FixedStringDetail::KeyView(b)) < 0;
+        }
+        else if constexpr (FixedStringDetail::IsFixedString<B>::value) {
+            return b.Compare(FixedStringDetail::KeyView(a)) > 0;
+        }
+        else {
+            return FixedStringDetail::KeyView(a) < FixedStringDetail::KeyView(b);
+        }
+    }
+};
+
+
+/// <summary>
+/// std::hash specialization so FixedString can key std::unordered_map and std::unordered_set directly.
+/// Uses FixedString::Hash rather than routing through std::string_view.
+/// </summary>
+namespace std
+{
+    template<size_t N, LengthPolicy L>
+    struct hash<FixedString<N, L>>
+    {
+        size_t operator()(const FixedString<N, L>& str) const noexcept { return static_cast<size_t>(str.Hash()); }
+    };
+}
+
 
 
 #endif
\ No newline at end of file
@@ -0,0 +1,356 @@
+// ============================================================================
+// TextCPP - High Performance String Utility Library
+// ----------------------------------------------------------------------------
+// File:        fixed_string_array.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+
+#ifndef __FIXED_STRING_ARRAY_H_GUARD
+#define __FIXED_STRING_ARRAY_H_GUARD
+
+#include <vector>
+#include <new>
+
+#include "fixed_string.h"
+
+
+/// <summary>
+/// A growable array of FixedStrings with structure-of-arrays search columns.
+/// Next to the contiguous N-byte string blocks it keeps two 8-byte columns per element:
+/// a tag (length and the high half of the hash) and the first eight bytes of the string.
+/// Find, Count and the prefix filters scan only those columns and touch a string block only
+/// for a likely match, so a scan reads 16 bytes per element instead of N.
+/// </summary>
+/// <remarks>
+/// Indices are stable: an element keeps its index until Clear or a shrinking Resize, and later
+/// Push calls reuse the indices a Resize dropped. Elements are read-only through operator[] and
+/// changed with Set, which keeps the columns in step with the contents.
+/// Reserve allocates without writing to the string blocks at all.
+/// </remarks>
+/// <typeparam name="N">Buffer size of each element, including the null terminator.</typeparam>
+/// <typeparam name="L">Length policy of each element.</typeparam>
+template<size_t N, LengthPolicy L = LengthPolicy::Scan>
+class FixedStringArray
+{
+    public:
+        using value_type = FixedString<N, L>;
+        using const_iterator = const value_type*;
+
+        static constexpr size_t npos = static_cast<size_t>(-1);
+
+        FixedStringArray() = default;
+
+        /// <summary>
+        /// Constructs an empty array with room for capacity elements. See Reserve.
+        /// </summary>
+        explicit FixedStringArray(size_t capacity) { Reserve(capacity); }
+
+        FixedStringArray(const FixedStringArray& other) { CopyFrom(other); }
+        FixedStringArray(FixedStringArray&& other) noexcept { MoveFrom(other); }
+
+        FixedStringArray& operator=(const FixedStringArray& other)
+        {
+            if (this != &other) { Release(); CopyFrom(other); }
+            return *this;
+        }
+
+        FixedStringArray& operator=(FixedStringArray&& other) noexcept
+        {
+            if (this != &other) { Release(); MoveFrom(other); }
+            return *this;
+        }
+
+        ~FixedStringArray() { Release(); }
+
+        /// <summary>
+        /// Ensures room for capacity elements. The string blocks are allocated but not written,
+        /// so reserving a large array costs no page faults until elements are added.
+        /// </summary>
+        void Reserve(size_t capacity)
+        {
+            if (capacity <= SlotCapacity) return;
+
+            value_type* slots = static_cast<value_type*>(::operator new(capacity * sizeof(value_type), std::align_val_t{ BlockAlignment }));
+
+            if (Size > 0) {
+                std::memcpy(static_cast<void*>(slots), static_cast<const void*>(Slots), Size * sizeof(value_type));
+            }
+
+            FreeSlots();
+            Slots = slots;
+            SlotCapacity = capacity;
+
+            Tags.reserve(capacity);
+            Prefixes.reserve(capacity);
+        }
+
+        /// <summary>
+        /// Grows or shrinks to count elements. New elements are empty; only their terminators are written.
+        /// </summary>
+        void Resize(size_t count)
+        {
+            if (count > Size)
+            {
+                Reserve(count);
+                value_type::ConstructEmpty(Slots + Size, count - Size);
+                Tags.resize(count, MakeTag(std::string_view("")));
+                Prefixes.resize(count, 0);
+            }
+            else
+            {
+                Tags.resize(count);
+                Prefixes.resize(count);
+            }
+
+            Size = count;
+        }
+
+        /// <summary>
+        /// Appends a string. Truncates like FixedString::Assign if it does not fit.
+        /// </summary>
+        /// <returns>The index of the new element, stable until Clear or a shrinking Resize.</returns>
+        size_t Push(std::string_view sv)
+        {
+            if (Size == SlotCapacity)
+            {
+                const char* first = reinterpret_cast<const char*>(Slots);
+                const char* last = reinterpret_cast<const char*>(Slots + Size);
+                const bool inside = Size > 0 && !std::less<const char*>()(sv.data(), first) && std::less<const char*>()(sv.data(), last);
+                const size_t offset = inside ? static_cast<size_t>(sv.data() - first) : 0;
+
+                Reserve(SlotCapacity < 16 ? 16 : SlotCapacity * 2);
+
+                if (inside) {                                   // The source was one of our elements; follow it to the new block
+                    sv = std::string_view(reinterpret_cast<const char*>(Slots) + offset, sv.size());
+                }
+            }
+
+            value_type* slot = new (static_cast<void*>(Slots + Size)) value_type(UninitializedTag{});
+            slot->Assign(sv);
+
+            const std::string_view stored(slot->Data, std::min(sv.size(), N - 1));
+            Tags.push_back(MakeTag(stored));
+            Prefixes.push_back(MakePrefix(stored));
+
+            return Size++;
+        }
+
+        /// <summary>
+        /// Replaces the element at index.
+        /// </summary>
+        void Set(size_t index, std::string_view sv)
+        {
+            assert(index < Size && "FixedStringArray: index out of range");
+
+            Slots[index].Assign(sv);
+
+            const std::string_view stored(Slots[index].Data, std::min(sv.size(), N - 1));
+            Tags[index] = MakeTag(stored);
+            Prefixes[index] = MakePrefix(stored);
+        }
+
+        /// <summary>
+        /// Removes every element. Capacity is kept.
+        /// </summary>
+        void Clear() { Size = 0; Tags.clear(); Prefixes.clear(); }
+
+        /// <summary>
+        /// Returns the element at index, read-only.
+        /// </summary>
+        const value_type& operator[](size_t index) const
+        {
+            assert(index < Size && "FixedStringArray: index out of range");
+            return Slots[index];
+        }
+
+        /// <summary>
+        /// Returns a view of the element at index. The length comes from the tag column, so nothing is scanned.
+        /// </summary>
+        std::string_view View(size_t index) const { return std::string_view(Slots[index].Data, Length(index)); }
+
+        /// <summary>
+        /// Returns the length of the element at index from the tag column. O(1) for either length policy.
+        /// </summary>
+        size_t Length(size_t index) const
+        {
+            assert(index < Size && "FixedStringArray: index out of range");
+            return static_cast<size_t>(Tags[index] & 0xFFFFFFFFull);
+        }
+
+        /// <summary>
+        /// Returns the index of the first element at or after from equal to key, or npos.
+        /// </summary>
+        size_t Find(std::string_view key, size_t from = 0) const
+        {
+            const uint64_t tag = MakeTag(key);
+
+            for (size_t i = from; i < Size; ++i)
+            {
+                if (Tags[i] == tag && FixedStringDetail::BytesEqual(Slots[i].Data, key.data(), key.size())) return i;
+            }
+
+            return npos;
+        }
+
+        /// <summary>
+        /// Returns true if any element equals key.
+        /// </summary>
+        bool Contains(std::string_view key) const { return Find(key) != npos; }
+
+        /// <summary>
+        /// Counts the elements equal to key.
+        /// </summary>
+        size_t Count(std::string_view key) const
+        {
+            size_t count = 0;
+            FindAll(key, [&count](size_t) { ++count; });
+            return count;
+        }
+
+        /// <summary>
+        /// Calls visit(index) for every element equal to key, in index order.
+        /// </summary>
+        template<typename Visitor>
+        void FindAll(std::string_view key, Visitor&& visit) const
+        {
+            const uint64_t tag = MakeTag(key);
+
+            for (size_t i = 0; i < Size; ++i)
+            {
+                if (Tags[i] == tag && FixedStringDetail::BytesEqual(Slots[i].Data, key.data(), key.size())) visit(i);
+            }
+        }
+
+        /// <summary>
+        /// Calls visit(index) for every element that starts with prefix, in index order.
+        /// Prefixes of up to eight bytes are decided entirely from the columns.
+        /// </summary>
+        template<typename Visitor>
+        void FilterPrefix(std::string_view prefix, Visitor&& visit) const
+        {
+            const size_t head = prefix.size() < 8 ? prefix.size() : 8;
+            const uint64_t mask = FixedStringDetail::LowBits(head * 8);
+            const uint64_t word = MakePrefix(prefix) & mask;
+
+            for (size_t i = 0; i < Size; ++i)
+            {
+                if ((Prefixes[i] & mask) != word || Length(i) < prefix.size()) continue;
+
+                if (prefix.size() <= 8 || FixedStringDetail::BytesEqual(Slots[i].Data + 8, prefix.data() + 8, prefix.size() - 8)) {
+                    visit(i);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Counts the elements that start with prefix.
+        /// </summary>
+        size_t CountPrefix(std::string_view prefix) const
+        {
+            size_t count = 0;
+            FilterPrefix(prefix, [&count](size_t) { ++count; });
+            return count;
+        }
+
+        /// <summary>
+        /// Number of elements.
+        /// </summary>
+        size_t size() const { return Size; }
+
+        /// <summary>
+        /// True if there are no elements.
+        /// </summary>
+        bool empty() const { return Size == 0; }
+
+        /// <summary>
+        /// Number of elements the array can hold before it reallocates.
+        /// </summary>
+        size_t Capacity() const { return SlotCapacity; }
+
+        const_iterator begin() const { return Slots; }
+        const_iterator end() const { return Slots + Size; }
+
+    private:
+        static constexpr size_t BlockAlignment = 64;            // String blocks start on a cache line
+
+        /// <summary>
+        /// High 32 bits of the hash over the low 32 bits of the length. Equal strings have equal tags.
+        /// </summary>
+        static uint64_t MakeTag(std::string_view sv)
+        {
+            return (FixedStringDetail::Hash64(sv.data(), sv.size()) & 0xFFFFFFFF00000000ull) | (static_cast<uint64_t>(sv.size()) & 0xFFFFFFFFull);
+        }
+
+        /// <summary>
+        /// The first eight bytes, zero-padded, with the first byte in the low position.
+        /// </summary>
+        static uint64_t MakePrefix(std::string_view sv)
+        {
+            char block[8] = {};
+            FixedStringDetail::CopyBytes(block, sv.data(), sv.size() < 8 ? sv.size() : 8);
+            return FixedStringDetail::LoadLittle64(block);
+        }
+
+        void FreeSlots()
+        {
+            if (Slots) ::operator delete(static_cast<void*>(Slots), std::align_val_t{ BlockAlignment });
+        }
+
+        void Release()
+        {
+            FreeSlots();
+            Slots = nullptr;
+            SlotCapacity = 0;
+            Size = 0;
+            Tags.clear();
+            Prefixes.clear();
+        }
+
+        void CopyFrom(const FixedStringArray& other)
+        {
+            Reserve(other.Size);
+
+            if (other.Size > 0) {
+                std::memcpy(static_cast<void*>(Slots), static_cast<const void*>(other.Slots), other.Size * sizeof(value_type));
+            }
+
+            Size = other.Size;
+            Tags = other.Tags;
+            Prefixes = other.Prefixes;
+        }
+
+        void MoveFrom(FixedStringArray& other)
+        {
+            Slots = other.Slots;
+            SlotCapacity = other.SlotCapacity;
+            Size = other.Size;
+            Tags = std::move(other.Tags);
+            Prefixes = std::move(other.Prefixes);
+
+            other.Slots = nullptr;
+            other.SlotCapacity = 0;
+            other.Size = 0;
+            other.Tags.clear();
+            other.Prefixes.clear();
+        }
+
+        value_type* Slots = nullptr;
+        size_t SlotCapacity = 0;
+        size_t Size = 0;
+        std::vector<uint64_t> Tags;
+        std::vector<uint64_t> Prefixes;
+};
+
+
+
+#endif
@@ -0,0 +1,424 @@
+// ============================================================================
+// TextCPP - High Performance String Utility Library
+// ----------------------------------------------------------------------------
+// File:        fixed_string_batch.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+
+#ifndef __FIXED_STRING_BATCH_H_GUARD
+#define __FIXED_STRING_BATCH_H_GUARD
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <memory>
+
+#include "fixed_string.h"
+
+#if __cplusplus >= 202002L && __has_include(<span>)
+#include <span>
+#define FIXED_STRING_HAS_SPAN 1
+#else
+#define FIXED_STRING_HAS_SPAN 0
+#endif
+
+
+namespace FixedStringDetail
+{
+    /// <summary>
+    /// Smallest run of elements worth handing to another thread.
+    /// </summary>
+    constexpr size_t ParallelGrain = 4096;
+
+    /// <summary>
+    /// Calls work() on threads threads, the caller being one of them, and waits for all of them.
+    /// </summary>
+    template<typename Work>
+    void RunOnThreads(unsigned threads, Work&& work)
+    {
+        std::vector<std::thread> pool;
+        pool.reserve(threads > 1 ? threads - 1 : 0);
+
+        for (unsigned t = 1; t < threads; ++t) pool.emplace_back([&work] { work(); });
+
+        work();
+        for (std::thread& t : pool) t.join();
+    }
+
+    /// <summary>
+    /// The number of chunks ParallelChunks splits count elements into for threads threads. At least 1.
+    /// </summary>
+    inline size_t ChunkCount(size_t count, unsigned threads)
+    {
+        size_t chunks = count / ParallelGrain;
+        if (chunks > threads) chunks = threads;
+
+        return chunks > 1 ? chunks : 1;
+    }
+
+    /// <summary>
+    /// Calls work(chunk, begin, end) over [0, count) split into ChunkCount(count, threads) contiguous
+    /// chunks, numbered in order, on up to threads threads including the caller. Runs inline when
+    /// threads is 1 or count is small. The split depends only on count and threads, so passes over
+    /// the same range see the same chunks.
+    /// </summary>
+    template<typename Work>
+    void ParallelChunksIndexed(size_t count, unsigned threads, Work&& work)
+    {
+        const size_t chunks = ChunkCount(count, threads);
+
+        if (chunks == 1) {
+            work(size_t(0), size_t(0), count);
+            return;
+        }
+
+        std::vector<std::thread> pool;
+        pool.reserve(chunks - 1);
+
+        const size_t step = (count + chunks - 1) / chunks;
+
+        for (size_t c = 1; c < chunks; ++c)
+        {
+            const size_t begin = c * step;
+            const size_t end = begin + step < count ? begin + step : count;
+            pool.emplace_back([&work, c, begin, end] { work(c, begin, end); });
+        }
+
+        work(size_t(0), size_t(0), step);
+        for (std::thread& t : pool) t.join();
+    }
+
+    /// <summary>
+    /// Calls work(begin, end) over [0, count) split into contiguous chunks. See ParallelChunksIndexed.
+    /// </summary>
+    template<typename Work>
+    void ParallelChunks(size_t count, unsigned threads, Work&& work)
+    {
+        ParallelChunksIndexed(count, threads, [&work](size_t, size_t begin, size_t end) { work(begin, end); });
+    }
+
+    /// <summary>
+    /// MSD radix sort of a permutation of FixedString records by contents. The key at depth d is
+    /// byte d + 1 while d is inside the string and 0 past its end, so shorter strings sort first,
+    /// exactly like FixedString::Compare; bytes after the terminator are never read.
+    /// </summary>
+    template<size_t N, LengthPolicy L>
+    class RadixSorter
+    {
+        public:
+            RadixSorter(const FixedString<N, L>* items, const uint32_t* lengths, uint16_t* keys) : Items(items), Lengths(lengths), Keys(keys) {}
+
+            /// <summary>
+            /// Sorts order[begin, end) by the contents from byte depth on, using scratch[begin, end).
+            /// </summary>
+            void Sort(uint32_t* order, uint32_t* scratch, size_t begin, size_t end, size_t depth) const
+            {
+                while (end - begin > InsertionLimit && depth < N)
+                {
+                    size_t starts[Buckets + 1];
+                    Partition(order, scratch, begin, end, depth, starts);
+
+                    for (size_t b = 1; b < Buckets - 1; ++b)           // Bucket 0 ended here and is already in order
+                    {
+                        if (starts[b + 1] - starts[b] > 1) Sort(order, scratch, starts[b], starts[b + 1], depth + 1);
+                    }
+
+                    begin = starts[Buckets - 1];                    // Loop on the last bucket instead of recursing
+                    ++depth;
+                }
+
+                InsertionSort(order, begin, end, depth);
+            }
+
+            /// <summary>
+            /// Stable counting pass on byte depth. starts[b] receives where bucket b begins.
+            /// Uses Keys[begin, end), so concurrent passes must cover disjoint ranges.
+            /// </summary>
+            void Partition(uint32_t* order, uint32_t* scratch, size_t begin, size_t end, size_t depth, size_t* starts) const
+            {
+                size_t counts[Buckets] = {};
+
+                for (size_t i = begin; i < end; ++i) ++counts[Keys[i] = Key(order[i], depth)];      // Each record is read once per pass
+
+                size_t at = begin;
+
+                for (size_t b = 0; b < Buckets; ++b)
+                {
+                    starts[b] = at;
+                    at += counts[b];
+                }
+
+                starts[Buckets] = end;
+
+                if (counts[Keys[begin]] == end - begin) return;     // One bucket: already partitioned
+
+                size_t next[Buckets];
+                std::memcpy(next, starts, sizeof(next));
+
+                for (size_t i = begin; i < end; ++i) scratch[next[Keys[i]]++] = order[i];
+
+                std::memcpy(order + begin, scratch + begin, (end - begin) * sizeof(uint32_t));
+            }
+
+            static constexpr size_t Buckets = 257;
+
+        private:
+            static constexpr size_t InsertionLimit = 24;
+
+            uint16_t Key(uint32_t index, size_t depth) const
+            {
+                return depth < Lengths[index] ? static_cast<uint16_t>(static_cast<unsigned char>(Items[index].Data[depth]) + 1) : 0;
+            }
+
+            void InsertionSort(uint32_t* order, size_t begin, size_t end, size_t depth) const
+            {
+                for (size_t i = begin + 1; i < end; ++i)
+                {
+                    const uint32_t moving = order[i];
+                    size_t j = i;
+
+                    while (j > begin && Less(moving, order[j - 1], depth))
+                    {
+                        order[j] = order[j - 1];
+                        --j;
+                    }
+
+                    order[j] = moving;
+                }
+            }
+
+            bool Less(uint32_t a, uint32_t b, size_t depth) const
+            {
+                const size_t aLen = Lengths[a] > depth ? Lengths[a] - depth : 0;
+                const size_t bLen = Lengths[b] > depth ? Lengths[b] - depth : 0;
+
+                return CompareStrings(Items[a].Data + depth, aLen, Items[b].Data + depth, bLen) < 0;
+            }
+
+            const FixedString<N, L>* Items;
+            const uint32_t* Lengths;
+            uint16_t* Keys;                                     // Bucket of each position in the current pass
+    };
+}
+
+
+namespace FixedStringDetail
+{
+    /// <summary>
+    /// The sorted order of count FixedStrings by contents: order[i] is the index of the record that
+    /// belongs at position i. Stable, so equal records keep their input order.
+    /// </summary>
+    template<size_t N, LengthPolicy L>
+    std::vector<uint32_t> RadixOrder(const FixedString<N, L>* items, size_t count, unsigned threads)
+    {
+        assert(count < UINT32_MAX && "RadixSort: too many records");
+
+        std::vector<uint32_t> lengths(count), order(count), scratch(count);
+        std::vector<uint16_t> keys(count);
+
+        ParallelChunks(count, threads, [&](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                lengths[i] = static_cast<uint32_t>(items[i].length());
+                order[i] = static_cast<uint32_t>(i);
+            }
+        });
+
+        using Sorter = RadixSorter<N, L>;
+        const Sorter sorter(items, lengths.data(), keys.data());
+
+        if (threads <= 1 || count < ParallelGrain) {
+            sorter.Sort(order.data(), scratch.data(), 0, count, 0);
+        }
+        else
+        {
+            size_t starts[Sorter::Buckets + 1];
+            sorter.Partition(order.data(), scratch.data(), 0, count, 0, starts);
+
+            std::atomic<size_t> nextBucket{ 1 };                            // Threads take buckets as they finish
+            RunOnThreads(threads, [&]
+            {
+                for (size_t b; (b = nextBucket.fetch_add(1, std::memory_order_relaxed)) < Sorter::Buckets; )
+                {
+                    if (starts[b + 1] - starts[b] > 1) sorter.Sort(order.data(), scratch.data(), starts[b], starts[b + 1], 1);
+                }
+            });
+        }
+
+        return order;
+    }
+
+    /// <summary>
+    /// Replaces items[0, count) with items[order[0]], items[order[1]], ... Each record is copied into
+    /// uninitialized scratch in its new position, then the scratch is copied back in chunks.
+    /// </summary>
+    template<size_t N, LengthPolicy L>
+    void GatherRecords(FixedString<N, L>* items, const uint32_t* order, size_t count, unsigned threads)
+    {
+        constexpr size_t Size = sizeof(FixedString<N, L>);
+        const std::unique_ptr<char[]> gathered(new char[count * Size]);         // Not value-initialized
+
+        ParallelChunks(count, threads, [&](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i) std::memcpy(gathered.get() + i * Size, static_cast<const void*>(items + order[i]), Size);
+        });
+
+        ParallelChunks(count, threads, [&](size_t begin, size_t end)
+        {
+            std::memcpy(static_cast<void*>(items + begin), gathered.get() + begin * Size, (end - begin) * Size);
+        });
+    }
+}
+
+
+/// <summary>
+/// Sorts count FixedStrings by contents, in the order of FixedString::Compare, with a stable MSD radix
+/// sort over the buffers. The sort runs on a permutation; each record is then copied twice, into scratch
+/// in sorted order and back. With threads above 1 the buckets of the first byte are sorted in parallel,
+/// and the copies are split across the threads.
+/// </summary>
+/// <param name="items">The records to sort in place.</param>
+/// <param name="count">The number of records. Must be below 2^32.</param>
+/// <param name="threads">Threads to use, including the caller.</param>
+template<size_t N, LengthPolicy L>
+void RadixSort(FixedString<N, L>* items, size_t count, unsigned threads = 1)
+{
+    if (count < 2) return;
+
+    const std::vector<uint32_t> order = FixedStringDetail::RadixOrder(items, count, threads);
+    FixedStringDetail::GatherRecords(items, order.data(), count, threads);
+}
+
+/// <summary>
+/// Sorts the records and removes duplicates, keeping the first of each in input order. Every step runs
+/// on up to threads threads: the radix sort, marking where each run of equal records starts, a prefix
+/// sum over the per-chunk counts, and gathering the first record of each run to the front. Only the
+/// kept records are copied, twice each as in RadixSort.
+/// </summary>
+/// <returns>The number of distinct records, now at the front of items.</returns>
+template<size_t N, LengthPolicy L>
+size_t SortUnique(FixedString<N, L>* items, size_t count, unsigned threads = 1)
+{
+    if (count < 2) return count;
+
+    const std::vector<uint32_t> order = FixedStringDetail::RadixOrder(items, count, threads);
+    std::vector<size_t> offsets(FixedStringDetail::ChunkCount(count, threads) + 1, 0);
+
+    auto isHead = [&](size_t i) { return i == 0 || !(items[order[i]] == items[order[i - 1]]); };
+
+    FixedStringDetail::ParallelChunksIndexed(count, threads, [&](size_t chunk, size_t begin, size_t end)
+    {
+        size_t heads = 0;
+        for (size_t i = begin; i < end; ++i) heads += isHead(i);
+        offsets[chunk + 1] = heads;
+    });
+
+    for (size_t c = 1; c < offsets.size(); ++c) offsets[c] += offsets[c - 1];
+
+    std::vector<uint32_t> kept(offsets.back());
+
+    FixedStringDetail::ParallelChunksIndexed(count, threads, [&](size_t chunk, size_t begin, size_t end)
+    {
+        size_t at = offsets[chunk];
+
+        for (size_t i = begin; i < end; ++i)
+        {
+            if (isHead(i)) kept[at++] = order[i];
+        }
+    });
+
+    FixedStringDetail::GatherRecords(items, kept.data(), kept.size(), threads);
+    return kept.size();
+}
+
+/// <summary>
+/// Writes items[i].Hash(seed) to hashes[i] for every record, a column ready for partitioning or lookup.
+/// </summary>
+template<size_t N, LengthPolicy L>
+void HashAll(const FixedString<N, L>* items, size_t count, uint64_t* hashes, uint64_t seed = 0, unsigned threads = 1)
+{
+    FixedStringDetail::ParallelChunks(count, threads, [=](size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; ++i) hashes[i] = items[i].Hash(seed);
+    });
+}
+
+/// <summary>
+/// Calls ToLowerAscii on every record.
+/// </summary>
+template<size_t N, LengthPolicy L>
+void ToLowerAsciiAll(FixedString<N, L>* items, size_t count, unsigned threads = 1)
+{
+    FixedStringDetail::ParallelChunks(count, threads, [=](size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; ++i) items[i].ToLowerAscii();
+    });
+}
+
+/// <summary>
+/// Calls ToUpperAscii on every record.
+/// </summary>
+template<size_t N, LengthPolicy L>
+void ToUpperAsciiAll(FixedString<N, L>* items, size_t count, unsigned threads = 1)
+{
+    FixedStringDetail::ParallelChunks(count, threads, [=](size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; ++i) items[i].ToUpperAscii();
+    });
+}
+
+/// <summary>
+/// Calls Trim(set) on every record.
+/// </summary>
+template<size_t N, LengthPolicy L>
+void TrimAll(FixedString<N, L>* items, size_t count, std::string_view set = FixedString<N, L>::Whitespace, unsigned threads = 1)
+{
+    FixedStringDetail::ParallelChunks(count, threads, [=](size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; ++i) items[i].Trim(set);
+    });
+}
+
+
+#if FIXED_STRING_HAS_SPAN
+/// <summary>
+/// std::span overloads of the batch operations. Pass std::span(container) explicitly; a container does
+/// not deduce to std::span.
+/// </summary>
+template<size_t N, LengthPolicy L>
+void RadixSort(std::span<FixedString<N, L>> items, unsigned threads = 1) { RadixSort(items.data(), items.size(), threads); }
+
+template<size_t N, LengthPolicy L>
+size_t SortUnique(std::span<FixedString<N, L>> items, unsigned threads = 1) { return SortUnique(items.data(), items.size(), threads); }
+
+template<size_t N, LengthPolicy L>
+void HashAll(std::span<const FixedString<N, L>> items, std::span<uint64_t> hashes, uint64_t seed = 0, unsigned threads = 1)
+{
+    assert(hashes.size() >= items.size() && "HashAll: hash column too short");
+    HashAll(items.data(), items.size(), hashes.data(), seed, threads);
+}
+
+template<size_t N, LengthPolicy L>
+void ToLowerAsciiAll(std::span<FixedString<N, L>> items, unsigned threads = 1) { ToLowerAsciiAll(items.data(), items.size(), threads); }
+
+template<size_t N, LengthPolicy L>
+void ToUpperAsciiAll(std::span<FixedString<N, L>> items, unsigned threads = 1) { ToUpperAsciiAll(items.data(), items.size(), threads); }
+
+template<size_t N, LengthPolicy L>
+void TrimAll(std::span<FixedString<N, L>> items, std::string_view set = FixedString<N, L>::Whitespace, unsigned threads = 1) { TrimAll(items.data(), items.size(), set, threads); }
+#endif
+
+
+
+#endif
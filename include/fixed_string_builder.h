@@ -0,0 +1,315 @@
+// ============================================================================
+// TextCPP - High Performance String Utility Library
+// ----------------------------------------------------------------------------
+// File:        fixed_string_builder.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+
+#ifndef __FIXED_STRING_BUILDER_H_GUARD
+#define __FIXED_STRING_BUILDER_H_GUARD
+
+#include "fixed_string.h"
+
+
+/// <summary>
+/// Selects what a FixedStringBuilder does when an appended piece does not fit.
+/// Every policy sets the builder's Truncated() flag.
+/// </summary>
+enum class TruncationPolicy
+{
+    /// <summary>
+    /// Asserts in debug builds. In release builds the piece is cut at the capacity, like FixedString::Assign.
+    /// </summary>
+    Assert,
+
+    /// <summary>
+    /// The piece is silently cut at the capacity.
+    /// </summary>
+    Truncate,
+
+    /// <summary>
+    /// A piece that does not fit entirely is dropped, so the result only ever holds whole pieces.
+    /// </summary>
+    Reject
+};
+
+
+namespace FixedStringDetail
+{
+    /// <summary>
+    /// Compile-time upper bound on the characters a concatenation piece can contribute.
+    /// Only types whose bound is known at compile time are specialized.
+    /// </summary>
+    template<typename T>
+    struct PieceCapacity;
+
+    template<size_t N, LengthPolicy L>
+    struct PieceCapacity<FixedString<N, L>> { static constexpr size_t Value = N - 1; };
+
+    template<size_t K>
+    struct PieceCapacity<char[K]> { static constexpr size_t Value = K - 1; };
+
+    template<>
+    struct PieceCapacity<char> { static constexpr size_t Value = 1; };
+
+    /// <summary>
+    /// Views a concatenation piece. FixedStrings use their length(), literals are folded by the compiler.
+    /// </summary>
+    FIXED_STRING_CONSTEXPR inline std::string_view PieceView(std::string_view sv) { return sv; }
+    FIXED_STRING_CONSTEXPR inline std::string_view PieceView(const char* str) { return std::string_view(str ? str : ""); }
+    FIXED_STRING_CONSTEXPR inline std::string_view PieceView(const std::string& str) { return std::string_view(str); }
+    FIXED_STRING_CONSTEXPR inline std::string_view PieceView(const char& c) { return std::string_view(&c, 1); }
+
+    /// <summary>
+    /// Other arithmetic pieces would convert to a temporary char; they are rejected rather than appended as a character.
+    /// </summary>
+    template<typename T, std::enable_if_t<std::is_arithmetic_v<T>, int> = 0>
+    std::string_view PieceView(const T&) = delete;
+
+    template<size_t N, LengthPolicy L>
+    FIXED_STRING_CONSTEXPR std::string_view PieceView(const FixedString<N, L>& str) { return static_cast<std::string_view>(str); }
+}
+
+
+/// <summary>
+/// Allocation-free string builder backed by an inline buffer of N bytes, including the null terminator.
+/// Each Append does one bounded memcpy and tracks the length, so building never rescans the contents.
+/// </summary>
+/// <typeparam name="N">The total buffer size in bytes, including the null terminator.</typeparam>
+/// <typeparam name="P">What happens when a piece does not fit. See TruncationPolicy.</typeparam>
+template<size_t N, TruncationPolicy P = TruncationPolicy::Assert>
+class FixedStringBuilder
+{
+    static_assert(N > 0, "FixedStringBuilder capacity must be > 0");
+
+    public:
+        /// <summary>
+        /// Constructs an empty builder. Only the terminator is written.
+        /// </summary>
+        FixedStringBuilder() { Buffer[0] = '\0'; }
+
+        /// <summary>
+        /// Appends a string view.
+        /// </summary>
+        /// <param name="sv">The piece to append.</param>
+        /// <returns>Reference to this builder, for chaining.</returns>
+        FixedStringBuilder& Append(std::string_view sv)
+        {
+            size_t copyLen = sv.size();
+            const size_t remaining = Remaining();
+
+            if (copyLen > remaining)
+            {
+                Overflowed = true;
+
+                if constexpr (P == TruncationPolicy::Assert) {
+                    assert(false && "FixedStringBuilder: input will be truncated");
+                }
+
+                if constexpr (P == TruncationPolicy::Reject) {
+                    return *this;
+                }
+
+                copyLen = remaining;
+            }
+
+            if (copyLen > 0) {
+                std::memcpy(Buffer + Length, sv.data(), copyLen);
+            }
+
+            Length += copyLen;
+            Buffer[Length] = '\0';
+            return *this;
+        }
+
+        /// <summary>
+        /// Appends a null-terminated C string. Null pointer is treated as empty string.
+        /// </summary>
+        FixedStringBuilder& Append(const char* str) { return Append(FixedStringDetail::PieceView(str)); }
+
+        /// <summary>
+        /// Appends a std::string without rescanning it.
+        /// </summary>
+        FixedStringBuilder& Append(const std::string& str) { return Append(std::string_view(str)); }
+
+        /// <summary>
+        /// Appends a single character.
+        /// </summary>
+        FixedStringBuilder& Append(char c) { return Append(std::string_view(&c, 1)); }
+
+        /// <summary>
+        /// Appends an integer or floating-point value in the shortest form of FixedString::AssignNumber,
+        /// so b &lt;&lt; 42 appends "42" rather than converting to a character. A value that does not fit is
+        /// handled like any other piece.
+        /// </summary>
+        template<typename T, std::enable_if_t<(std::is_integral_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char>) || std::is_floating_point_v<T>, int> = 0>
+        FixedStringBuilder& Append(T value)
+        {
+            FixedString<32> text(UninitializedTag{});
+            text.AssignNumber(value);
+            return Append(static_cast<std::string_view>(text));
+        }
+
+        /// <summary>
+        /// Appends a FixedString of any capacity or policy.
+        /// </summary>
+        template<size_t M, LengthPolicy LM>
+        FixedStringBuilder& Append(const FixedString<M, LM>& str) { return Append(static_cast<std::string_view>(str)); }
+
+        /// <summary>
+        /// Appends several pieces in order.
+        /// </summary>
+        template<typename First, typename Second, typename... Rest>
+        FixedStringBuilder& Append(const First& first, const Second& second, const Rest&... rest)
+        {
+            Append(first);
+            return Append(second, rest...);
+        }
+
+        /// <summary>
+        /// Appends a piece. Equivalent to Append.
+        /// </summary>
+        template<typename T>
+        FixedStringBuilder& operator+=(const T& piece) { return Append(piece); }
+
+        /// <summary>
+        /// Appends a piece. Equivalent to Append, useful for stream-style chains.
+        /// </summary>
+        template<typename T>
+        FixedStringBuilder& operator<<(const T& piece) { return Append(piece); }
+
+        /// <summary>
+        /// Empties the builder and clears the truncation flag.
+        /// </summary>
+        void Clear() { Length = 0; Buffer[0] = '\0'; Overflowed = false; }
+
+        /// <summary>
+        /// Returns the current length in characters, excluding the null terminator. O(1).
+        /// </summary>
+        size_t length() const { return Length; }
+
+        /// <summary>
+        /// Returns true if nothing has been appended.
+        /// </summary>
+        bool empty() const { return Length == 0; }
+
+        /// <summary>
+        /// Returns the number of characters that can still be appended.
+        /// </summary>
+        size_t Remaining() const { return (N - 1) - Length; }
+
+        /// <summary>
+        /// Returns true if any appended piece was cut or rejected since construction or the last Clear.
+        /// </summary>
+        bool Truncated() const { return Overflowed; }
+
+        /// <summary>
+        /// Returns a null-terminated pointer to the internal buffer.
+        /// </summary>
+        const char* c_str() const { return Buffer; }
+
+        /// <summary>
+        /// Returns a view of the built contents. Does not allocate.
+        /// </summary>
+        std::string_view View() const { return std::string_view(Buffer, Length); }
+
+        /// <summary>
+        /// Implicit conversion to std::string_view. Does not allocate.
+        /// </summary>
+        operator std::string_view() const { return View(); }
+
+        /// <summary>
+        /// Copies the built contents into a FixedString with one memcpy. Instrumentation counts it as one
+        /// assignment, truncated if any appended piece was.
+        /// </summary>
+        /// <typeparam name="L">Length policy of the result.</typeparam>
+        template<LengthPolicy L = LengthPolicy::Scan>
+        FixedString<N, L> ToFixedString() const
+        {
+            FixedString<N, L> out(UninitializedTag{});
+            std::memcpy(out.Data, Buffer, Length);
+            out.SetLength(Length, Overflowed);
+            return out;
+        }
+
+    private:
+        char Buffer[N];
+        size_t Length = 0;
+        bool Overflowed = false;
+};
+
+
+/// <summary>
+/// Concatenates FixedStrings, string literals and characters into a FixedString sized at compile time
+/// to hold the longest possible result, so it can never truncate. Concatenating FixedStrings of
+/// capacity N and M yields a FixedString of capacity N + M - 1.
+/// All lengths are read once up front, then each piece is copied with a single memcpy.
+/// constexpr in C++20, so concatenated names can be built at compile time.
+/// </summary>
+/// <typeparam name="L">Length policy of the result.</typeparam>
+/// <param name="pieces">The pieces to concatenate, in order.</param>
+/// <returns>The concatenated string.</returns>
+template<LengthPolicy L = LengthPolicy::Scan, typename... Pieces>
+FIXED_STRING_CONSTEXPR FixedString<(FixedStringDetail::PieceCapacity<Pieces>::Value + ... + 1), L> Concat(const Pieces&... pieces)
+{
+    FixedString<(FixedStringDetail::PieceCapacity<Pieces>::Value + ... + 1), L> out(UninitializedTag{});
+
+    const std::string_view views[] = { std::string_view(), FixedStringDetail::PieceView(pieces)... };
+    size_t offset = 0;
+
+    for (const std::string_view& view : views)
+    {
+        FixedStringDetail::CopyBytes(out.Data + offset, view.data(), view.size());
+        offset += view.size();
+    }
+
+    out.SetLength(offset);
+    return out;
+}
+
+
+/// <summary>
+/// Concatenates any string-like pieces into an existing FixedString, replacing its contents.
+/// The total length is computed once, then each piece is copied with a single memcpy.
+/// If the total does not fit the result is cut at the capacity, with the same debug assert as Assign.
+/// </summary>
+/// <param name="out">The destination.</param>
+/// <param name="pieces">The pieces: FixedString, std::string, std::string_view, C strings or characters. Must not alias out.</param>
+template<size_t N, LengthPolicy L, typename... Pieces>
+void ConcatTo(FixedString<N, L>& out, const Pieces&... pieces)
+{
+    const std::string_view views[] = { std::string_view(), FixedStringDetail::PieceView(pieces)... };
+
+    size_t total = 0;
+    for (const std::string_view& view : views) total += view.size();
+
+    assert(total < N && "FixedString: input will be truncated");
+
+    size_t offset = 0;
+    for (const std::string_view& view : views)
+    {
+        const size_t copyLen = std::min(view.size(), (N - 1) - offset);
+
+        if (copyLen > 0) {
+            std::memcpy(out.Data + offset, view.data(), copyLen);
+        }
+
+        offset += copyLen;
+    }
+
+    out.SetLength(offset, total > offset);
+}
+
+
+
+#endif
@@ -0,0 +1,93 @@
+// ============================================================================
+// TextCPP - High Performance String Utility Library
+// ----------------------------------------------------------------------------
+// File:        fixed_string_config.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+
+#ifndef __FIXED_STRING_CONFIG_H_GUARD
+#define __FIXED_STRING_CONFIG_H_GUARD
+
+// The macros below change the bodies of inline FixedString members. Set them the same way for every
+// translation unit of a program, on the compiler command line or in a header included before this one,
+// never with a #define in a single source file.
+
+
+/// <summary>
+/// Define FIXED_STRING_CANONICAL_TAIL to 1 to make every FixedString clear the bytes past its contents
+/// whenever its length is set, as FixedString<8> and FixedString<16> always do. Buffers then depend only
+/// on their contents, so records can be written, hashed, deduplicated or diffed as raw bytes. The cost is
+/// a memset of the unused tail on each assignment, and UninitializedTag construction no longer skips zeroing.
+/// </summary>
+#if !defined(FIXED_STRING_CANONICAL_TAIL)
+#define FIXED_STRING_CANONICAL_TAIL 0
+#endif
+
+
+/// <summary>
+/// Define FIXED_STRING_INSTRUMENTATION to 1 to count, per FixedString capacity, how many assignments
+/// were made, how many were truncated and how full the buffers were. Counters are per thread, so the
+/// hot path is a few uncontended atomic adds. When 0 (the default) the hooks are empty inline functions and
+/// FixedStringStats() returns nothing.
+/// </summary>
+#if !defined(FIXED_STRING_INSTRUMENTATION)
+#define FIXED_STRING_INSTRUMENTATION 0
+#endif
+
+
+/// <summary>
+/// Define FIXED_STRING_VERIFY_FAST_PATHS to 1 to check every result of the word-wise and SIMD fast paths
+/// of FixedString (length, equality, Compare, Hash, Find, RFind, FindFirstOf, FindFirstNotOf) against the
+/// std::string_view operation it replaces, and abort with a message on the first disagreement. The check
+/// runs in optimized and NDEBUG builds too, since that is where the fast paths are compiled as shipped.
+/// Each call then also pays for the reference, so enable it for test runs and fuzzing, not in production.
+/// </summary>
+#if !defined(FIXED_STRING_VERIFY_FAST_PATHS)
+#define FIXED_STRING_VERIFY_FAST_PATHS 0
+#endif
+
+
+#if FIXED_STRING_CANONICAL_TAIL
+#define FIXED_STRING_ABI_TAIL Tail
+#else
+#define FIXED_STRING_ABI_TAIL
+#endif
+
+#if FIXED_STRING_INSTRUMENTATION
+#define FIXED_STRING_ABI_INSTRUMENTED Instrumented
+#else
+#define FIXED_STRING_ABI_INSTRUMENTED
+#endif
+
+#if FIXED_STRING_VERIFY_FAST_PATHS
+#define FIXED_STRING_ABI_VERIFIED Verified
+#else
+#define FIXED_STRING_ABI_VERIFIED
+#endif
+
+#define FIXED_STRING_ABI_PASTE(a, b, c, d) a##b##c##d
+#define FIXED_STRING_ABI_NAME(a, b, c, d) FIXED_STRING_ABI_PASTE(a, b, c, d)
+
+/// <summary>
+/// Name of the inline namespace holding FixedString and the instrumentation hooks, spelled from the
+/// settings above: FixedStringAbi, with Tail, Instrumented and Verified appended for each macro set to 1.
+/// Code is written against the unqualified names as usual, but each setting mangles differently, so a
+/// translation unit built with another setting gets its own copies of the inline members instead of sharing
+/// one at link time, and a function taking a FixedString that is declared under one setting and defined
+/// under another fails to link.
+/// </summary>
+#define FIXED_STRING_ABI FIXED_STRING_ABI_NAME(FixedStringAbi, FIXED_STRING_ABI_TAIL, FIXED_STRING_ABI_INSTRUMENTED, FIXED_STRING_ABI_VERIFIED)
+
+
+
+#endif
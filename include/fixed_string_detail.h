@@ -0,0 +1,576 @@
+// ============================================================================
+// TextCPP - High Performance String Utility Library
+// ----------------------------------------------------------------------------
+// File:        fixed_string_detail.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+
+#ifndef __FIXED_STRING_DETAIL_H_GUARD
+#define __FIXED_STRING_DETAIL_H_GUARD
+
+#include <cstdint>
+#include <cstddef>
+#include <charconv>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <cstring>
+#include <type_traits>
+
+#if defined(_MSC_VER)
+#include <stdlib.h>
+#endif
+
+
+/// <summary>
+/// Expands to constexpr when the compiler can tell constant evaluation from runtime execution
+/// (C++20 std::is_constant_evaluated), and to nothing otherwise. Functions marked with it keep
+/// their memcpy / strlen runtime paths and switch to plain loops only during constant evaluation.
+/// </summary>
+#if defined(__cpp_lib_is_constant_evaluated) && __cpp_lib_is_constant_evaluated >= 201811L
+#define FIXED_STRING_CONSTEXPR constexpr
+#define FIXED_STRING_HAS_CONSTEXPR 1
+#else
+#define FIXED_STRING_CONSTEXPR
+#define FIXED_STRING_HAS_CONSTEXPR 0
+#endif
+
+/// <summary>
+/// 1 when the standard library provides floating-point std::to_chars / std::from_chars.
+/// Some libraries ship only the integer overloads; floating-point conversions then fall back to the C library.
+/// Define it to 0 before including to force the fallback.
+/// </summary>
+#if !defined(FIXED_STRING_FLOAT_TO_CHARS)
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#define FIXED_STRING_FLOAT_TO_CHARS 1
+#else
+#define FIXED_STRING_FLOAT_TO_CHARS 0
+#endif
+#endif
+
+#if !FIXED_STRING_FLOAT_TO_CHARS
+#include <clocale>
+#include <cerrno>
+#endif
+
+
+/// <summary>
+/// Internal word-level helpers shared by the TextCPP string types.
+/// Not part of the public API; signatures may change between releases.
+/// </summary>
+namespace FixedStringDetail
+{
+    /// <summary>
+    /// True when the target stores multi-byte integers least significant byte first.
+    /// </summary>
+#if defined(_MSC_VER) || (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+    constexpr bool IsLittleEndian = true;
+#else
+    constexpr bool IsLittleEndian = false;
+#endif
+
+    /// <summary>
+    /// True while the enclosing call is being constant-evaluated. Always false before C++20.
+    /// </summary>
+    constexpr bool IsConstantEvaluated()
+    {
+#if FIXED_STRING_HAS_CONSTEXPR
+        return std::is_constant_evaluated();
+#else
+        return false;
+#endif
+    }
+
+    /// <summary>
+    /// True for the pointer types FixedString accepts as null-terminated C strings.
+    /// Arrays are excluded so that literals reach the sized array overloads.
+    /// </summary>
+    template<typename T>
+    constexpr bool IsCString = std::is_same_v<T, const char*> || std::is_same_v<T, char*> || std::is_same_v<T, std::nullptr_t>;
+
+    /// <summary>
+    /// Assembles count bytes into an integer in native byte order. Constant-evaluation path of the loads.
+    /// </summary>
+    template<typename T>
+    constexpr T LoadBytes(const char* p)
+    {
+        T v = 0;
+
+        for (size_t i = 0; i < sizeof(T); ++i)
+        {
+            const T byte = static_cast<unsigned char>(p[i]);
+            v |= byte << (8 * (IsLittleEndian ? i : sizeof(T) - 1 - i));
+        }
+
+        return v;
+    }
+
+    /// <summary>
+    /// Unaligned 64-bit load in native byte order.
+    /// </summary>
+    FIXED_STRING_CONSTEXPR inline uint64_t Load64(const char* p)
+    {
+        if (IsConstantEvaluated()) return LoadBytes<uint64_t>(p);
+
+        uint64_t v; std::memcpy(&v, p, sizeof(v)); return v;
+    }
+
+    /// <summary>
+    /// Unaligned 32-bit load in native byte order.
+    /// </summary>
+    FIXED_STRING_CONSTEXPR inline uint32_t Load32(const char* p)
+    {
+        if (IsConstantEvaluated()) return LoadBytes<uint32_t>(p);
+
+        uint32_t v; std::memcpy(&v, p, sizeof(v)); return v;
+    }
+
+    /// <summary>
+    /// Unaligned 16-bit load in native byte order.
+    /// </summary>
+    FIXED_STRING_CONSTEXPR inline uint16_t Load16(const char* p)
+    {
+        if (IsConstantEvaluated()) return LoadBytes<uint16_t>(p);
+
+        uint16_t v; std::memcpy(&v, p, sizeof(v)); return v;
+    }
+
+    /// <summary>
+    /// Copies count bytes. memcpy at runtime, a loop during constant evaluation.
+    /// </summary>
+    FIXED_STRING_CONSTEXPR inline void CopyBytes(char* dst, const char* src, size_t count)
+    {
+        if (IsConstantEvaluated())
+        {
+            for (size_t i = 0; i < count; ++i) dst[i] = src[i];
+            return;
+        }
+
+        if (count > 0) std::memcpy(dst, src, count);
+    }
+
+    /// <summary>
+    /// Moves count bytes to a lower address within the same buffer (dst <= src). memmove at runtime,
+    /// a forward loop during constant evaluation.
+    /// </summary>
+    FIXED_STRING_CONSTEXPR inline void MoveBytesDown(char* dst, const char* src, size_t count)
+    {
+        if (IsConstantEvaluated())
+        {
+            for (size_t i = 0; i < count; ++i) dst[i] = src[i];
+            return;
+        }
+
+        if (count > 0) std::memmove(dst, src, count);
+    }
+
+    /// <summary>
+    /// Sets count bytes to value. memset at runtime, a loop during constant evaluation.
+    /// </summary>
+    FIXED_STRING_CONSTEXPR inline void FillBytes(char* dst, char value, size_t count)
+    {
+        if (IsConstantEvaluated())
+        {
+            for (size_t i = 0; i < count; ++i) dst[i] = value;
+            return;
+        }
+
+        if (count > 0) std::memset(dst, value, count);
+    }
+
+    /// <summary>
+    /// Compares two null-terminated strings with the same result sign as std::strcmp.
+    /// </summary>
+    FIXED_STRING_CONSTEXPR inline int CompareCString(const char* a, const char* b)
+    {
+        if (!IsConstantEvaluated()) return std::strcmp(a, b);
+
+        for (;; ++a, ++b)
+        {
+            const unsigned char x = static_cast<unsigned char>(*a);
+            const unsigned char y = static_cast<unsigned char>(*b);
+
+            if (x != y) return x < y ? -1 : 1;
+            if (x == 0) return 0;
+        }
+    }
+
+    /// <summary>
+    /// Length of the string at p up to its first null, or max if none of the first max bytes is null.
+    /// memchr at runtime, which compilers fold for literals; a loop during constant evaluation.
+    /// </summary>
+    FIXED_STRING_CONSTEXPR inline size_t BoundedLength(const char* p, size_t max)
+    {
+        if (IsConstantEvaluated())
+        {
+            size_t len = 0;
+            while (len < max && p[len] != '\0') ++len;
+            return len;
+        }
+
+        const void* end = std::memchr(p, '\0', max);
+        return end ? static_cast<size_t>(static_cast<const char*>(end) - p) : max;
+    }
+
+    /// <summary>
+    /// Reverses the byte order of a 64-bit value.
+    /// </summary>
+    FIXED_STRING_CONSTEXPR inline uint64_t ByteSwap64(uint64_t v)
+    {
+        if (IsConstantEvaluated())
+        {
+            uint64_t r = 0;
+            for (int i = 0; i < 8; ++i) r |= ((v >> (8 * i)) & 0xFF) << (8 * (7 - i));
+            return r;
+        }
+
+#if defined(_MSC_VER)
+        return _byteswap_uint64(v);
+#else
+        return __builtin_bswap64(v);
+#endif
+    }
+
+    /// <summary>
+    /// Converts a natively loaded word so that integer ordering matches byte-wise lexicographic ordering.
+    /// </summary>
+    FIXED_STRING_CONSTEXPR inline uint64_t ToBigEndian64(uint64_t v) { return IsLittleEndian ? ByteSwap64(v) : v; }
+
+    /// <summary>
+    /// Compares two byte ranges of equal length for equality, 8 bytes at a time.
+    /// Short and tail ranges use overlapping loads, so no byte outside [0, len) is read. Ranges longer
+    /// than 32 bytes go to memcmp at run time, which the C library dispatches to its widest vector unit.
+    /// </summary>
+    /// <param name="a">The first range.</param>
+    /// <param name="b">The second range.</param>
+    /// <param name="len">The number of bytes to compare.</param>
+    /// <returns>True if all len bytes are identical.</returns>
+    FIXED_STRING_CONSTEXPR inline bool BytesEqual(const char* a, const char* b, size_t len)
+    {
+        if (len > 32 && !IsConstantEvaluated()) return std::memcmp(a, b, len) == 0;
+
+        if (len >= 8)
+        {
+            for (size_t i = 0; i + 8 <= len; i += 8)
+            {
+                if (Load64(a + i) != Load64(b + i))
+                    return false;
+            }
+
+            return Load64(a + len - 8) == Load64(b + len - 8);    // Overlapping tail word
+        }
+
+        if (len >= 4) return Load32(a) == Load32(b) && Load32(a + len - 4) == Load32(b + len - 4);
+        if (len >= 2) return Load16(a) == Load16(b) && Load16(a + len - 2) == Load16(b + len - 2);
+        if (len == 1) return a[0] == b[0];
+
+        return true;
+    }
+
+    /// <summary>
+    /// Lexicographically compares two byte ranges of equal length as unsigned bytes, 8 bytes at a time.
+    /// </summary>
+    /// <param name="a">The first range.</param>
+    /// <param name="b">The second range.</param>
+    /// <param name="len">The number of bytes to compare.</param>
+    /// <returns>Negative, zero or positive, with the same meaning as std::memcmp.</returns>
+    FIXED_STRING_CONSTEXPR inline int CompareBytes(const char* a, const char* b, size_t len)
+    {
+        size_t i = 0;
+
+        for (; i + 8 <= len; i += 8)
+        {
+            uint64_t x = Load64(a + i);
+            uint64_t y = Load64(b + i);
+
+            if (x != y) {
+                return ToBigEndian64(x) < ToBigEndian64(y) ? -1 : 1;
+            }
+        }
+
+        for (; i < len; ++i)
+        {
+            unsigned char x = static_cast<unsigned char>(a[i]);
+            unsigned char y = static_cast<unsigned char>(b[i]);
+
+            if (x != y) {
+                return x < y ? -1 : 1;
+            }
+        }
+
+        return 0;
+    }
+
+    /// <summary>
+    /// Full 64x64 to 128-bit multiply. Returns the low half and writes the high half to hi.
+    /// </summary>
+    FIXED_STRING_CONSTEXPR inline uint64_t Multiply128(uint64_t a, uint64_t b, uint64_t* hi)
+    {
+#if defined(__SIZEOF_INT128__)
+        __uint128_t r = static_cast<__uint128_t>(a) * b;
+        *hi = static_cast<uint64_t>(r >> 64);
+        return static_cast<uint64_t>(r);
+#else
+#if defined(_MSC_VER) && defined(_M_X64)
+        if (!IsConstantEvaluated()) return _umul128(a, b, hi);
+#endif
+        uint64_t aLo = a & 0xFFFFFFFFull, aHi = a >> 32;
+        uint64_t bLo = b & 0xFFFFFFFFull, bHi = b >> 32;
+        uint64_t ll = aLo * bLo, lh = aLo * bHi, hl = aHi * bLo, hh = aHi * bHi;
+        uint64_t mid = (ll >> 32) + (lh & 0xFFFFFFFFull) + (hl & 0xFFFFFFFFull);
+        *hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+        return (mid << 32) | (ll & 0xFFFFFFFFull);
+#endif
+    }
+
+    /// <summary>
+    /// Multiplies two words to 128 bits and folds the halves together with xor.
+    /// </summary>
+    FIXED_STRING_CONSTEXPR inline uint64_t HashMix(uint64_t a, uint64_t b)
+    {
+        uint64_t hi = 0;
+        uint64_t lo = Multiply128(a, b, &hi);
+        return lo ^ hi;
+    }
+
+    /// <summary>
+    /// Constants for Hash64.
+    /// </summary>
+    constexpr uint64_t HashSecret0 = 0x2d358dccaa6c78a5ull;
+    constexpr uint64_t HashSecret1 = 0x8bb84b93962eacc9ull;
+    constexpr uint64_t HashSecret2 = 0x4b33a62ed433d4a3ull;
+    constexpr uint64_t HashSecret3 = 0x4d5a2da51de1aa47ull;
+
+    /// <summary>
+    /// Fast non-cryptographic 64-bit hash of a byte range, following the wyhash construction.
+    /// Reads 8-byte words, 48 bytes per round on long inputs, and never reads outside [0, len).
+    /// The result depends only on the bytes and the seed, so equal contents hash equally
+    /// regardless of the string type holding them. Not stable across platforms or releases.
+    /// </summary>
+    /// <param name="p">The bytes to hash.</param>
+    /// <param name="len">The number of bytes.</param>
+    /// <param name="seed">Optional seed.</param>
+    /// <returns>The 64-bit hash.</returns>
+    FIXED_STRING_CONSTEXPR inline uint64_t Hash64(const char* p, size_t len, uint64_t seed = 0)
+    {
+        seed ^= HashMix(seed ^ HashSecret0, HashSecret1);
+
+        uint64_t a = 0, b = 0;
+
+        if (len <= 16)
+        {
+            if (len >= 4)
+            {
+                size_t step = (len >> 3) << 2;                      // 0 for 4..7 bytes, 4 for 8..16 bytes
+                a = (static_cast<uint64_t>(Load32(p)) << 32) | Load32(p + step);
+                b = (static_cast<uint64_t>(Load32(p + len - 4)) << 32) | Load32(p + len - 4 - step);
+            }
+            else if (len > 0)
+            {
+                a = (static_cast<uint64_t>(static_cast<unsigned char>(p[0])) << 16)
+                  | (static_cast<uint64_t>(static_cast<unsigned char>(p[len >> 1])) << 8)
+                  | static_cast<unsigned char>(p[len - 1]);
+                b = 0;
+            }
+            else
+            {
+                a = b = 0;
+            }
+        }
+        else
+        {
+            size_t i = len;
+
+            if (i > 48)
+            {
+                uint64_t see1 = seed, see2 = seed;
+
+                do
+                {
+                    seed = HashMix(Load64(p) ^ HashSecret1, Load64(p + 8) ^ seed);
+                    see1 = HashMix(Load64(p + 16) ^ HashSecret2, Load64(p + 24) ^ see1);
+                    see2 = HashMix(Load64(p + 32) ^ HashSecret3, Load64(p + 40) ^ see2);
+                    p += 48; i -= 48;
+                } while (i > 48);
+
+                seed ^= see1 ^ see2;
+            }
+
+            while (i > 16)
+            {
+                seed = HashMix(Load64(p) ^ HashSecret1, Load64(p + 8) ^ seed);
+                p += 16; i -= 16;
+            }
+
+            a = Load64(p + i - 16);                                 // Final 16 bytes, may overlap the last round
+            b = Load64(p + i - 8);
+        }
+
+        a ^= HashSecret1;
+        b ^= seed;
+        uint64_t hi = 0;
+        a = Multiply128(a, b, &hi);
+        b = hi;
+
+        return HashMix(a ^ HashSecret0 ^ len, b ^ HashSecret1);
+    }
+
+    /// <summary>
+    /// Three-way comparison of two strings of known length. Shorter strings order first on a common prefix.
+    /// </summary>
+    /// <returns>Negative, zero or positive, with the same meaning as std::string_view::compare.</returns>
+    FIXED_STRING_CONSTEXPR inline int CompareStrings(const char* a, size_t aLen, const char* b, size_t bLen)
+    {
+        int result = CompareBytes(a, b, aLen < bLen ? aLen : bLen);
+
+        if (result != 0) return result;
+        if (aLen == bLen) return 0;
+
+        return aLen < bLen ? -1 : 1;
+    }
+
+#if !FIXED_STRING_FLOAT_TO_CHARS
+    /// <summary>
+    /// snprintf fallback for the shortest round-trip form of a floating-point value: the lowest %g
+    /// precision that parses back to the same value. Returns what snprintf returned for that precision.
+    /// </summary>
+    template<typename T>
+    inline int PrintShortest(char* out, size_t size, T value)
+    {
+        const int maxPrecision = std::numeric_limits<T>::max_digits10;
+
+        for (int precision = 1; ; ++precision)
+        {
+            const int written = std::snprintf(out, size, "%.*g", precision, static_cast<double>(value));
+
+            if (precision >= maxPrecision || written < 0 || static_cast<size_t>(written) >= size) return written;
+            if (static_cast<T>(std::strtod(out, nullptr)) == value) return written;
+        }
+    }
+
+    /// <summary>
+    /// Size of ParseFloat's stack copy. The fallback rejects longer numbers instead of allocating for them;
+    /// the shortest round-trip form of any double is under 32 characters.
+    /// </summary>
+    constexpr size_t MaxFloatText = 128;
+
+    /// <summary>
+    /// Length of the longest prefix of [first, last) that std::from_chars would parse as a floating-point
+    /// number in chars_format::general: an optional '-', then digits with an optional '.' (at least one
+    /// digit), then an optional exponent that is only taken if it has digits; or inf, infinity, nan or
+    /// nan(chars), in any case. 0 if there is none. No whitespace, '+' or hex prefix is accepted.
+    /// </summary>
+    inline size_t FloatSyntaxLength(const char* first, const char* last)
+    {
+        const char* p = first;
+        if (p != last && *p == '-') ++p;
+
+        auto isDigit = [](char c) { return c >= '0' && c <= '9'; };
+        auto matchWord = [&](const char* word) {
+            const char* q = p;
+            for (; *word; ++word, ++q) {
+                if (q == last || (*q | 0x20) != *word) return static_cast<const char*>(nullptr);
+            }
+            return q;
+        };
+
+        if (const char* end = matchWord("inf"))
+        {
+            p = end;
+            const char* longer = matchWord("inity");
+            return static_cast<size_t>((longer ? longer : end) - first);
+        }
+
+        if (const char* end = matchWord("nan"))
+        {
+            const char* q = end;
+
+            if (q != last && *q == '(')
+            {
+                ++q;
+                while (q != last && (isDigit(*q) || ((*q | 0x20) >= 'a' && (*q | 0x20) <= 'z') || *q == '_')) ++q;
+                if (q != last && *q == ')') return static_cast<size_t>(q + 1 - first);
+            }
+
+            return static_cast<size_t>(end - first);
+        }
+
+        size_t digits = 0;
+        for (; p != last && isDigit(*p); ++p) ++digits;
+
+        if (p != last && *p == '.') {
+            ++p;
+            for (; p != last && isDigit(*p); ++p) ++digits;
+        }
+
+        if (digits == 0) return 0;
+
+        if (p != last && (*p | 0x20) == 'e')
+        {
+            const char* q = p + 1;
+            if (q != last && (*q == '+' || *q == '-')) ++q;
+
+            if (q != last && isDigit(*q)) {
+                while (q != last && isDigit(*q)) ++q;
+                p = q;
+            }
+        }
+
+        return static_cast<size_t>(p - first);
+    }
+
+    /// <summary>
+    /// std::from_chars for floating-point types on libraries that lack it. The accepted syntax is checked
+    /// first (see FloatSyntaxLength), then only that prefix is converted with strtof, strtod or strtold
+    /// for T, with '.' mapped to the current locale's decimal point. So the result, the consumed length
+    /// and the errors match std::from_chars in chars_format::general; value is unchanged on failure.
+    /// The prefix is copied to a stack buffer so it can be terminated, which never allocates: a number
+    /// of MaxFloatText characters or more is rejected with std::errc::invalid_argument.
+    /// </summary>
+    template<typename T>
+    inline std::from_chars_result ParseFloat(const char* first, const char* last, T& value)
+    {
+        const size_t len = FloatSyntaxLength(first, last);
+        if (len == 0 || len >= MaxFloatText) return { first, std::errc::invalid_argument };
+
+        char copy[MaxFloatText];
+
+        const char point = *std::localeconv()->decimal_point;
+
+        for (size_t i = 0; i < len; ++i) copy[i] = first[i] == '.' ? point : first[i];
+        copy[len] = '\0';
+
+        char* end = nullptr;
+        errno = 0;
+
+        T parsed;
+        if constexpr (std::is_same_v<T, float>) parsed = std::strtof(copy, &end);
+        else if constexpr (std::is_same_v<T, double>) parsed = std::strtod(copy, &end);
+        else parsed = std::strtold(copy, &end);
+
+        const bool complete = end == copy + len;
+        const bool outOfRange = errno == ERANGE && (parsed == 0 || parsed > std::numeric_limits<T>::max() || parsed < std::numeric_limits<T>::lowest());   // subnormals are in range for from_chars
+
+        if (!complete) return { first, std::errc::invalid_argument };
+        if (outOfRange) return { first + len, std::errc::result_out_of_range };
+
+        value = parsed;
+        return { first + len, std::errc() };
+    }
+#endif
+
+}
+
+
+
+#endif
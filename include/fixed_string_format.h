@@ -0,0 +1,543 @@
+// ============================================================================
+// TextCPP - High Performance String Utility Library
+// ----------------------------------------------------------------------------
+// File:        fixed_string_format.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+
+#ifndef __FIXED_STRING_FORMAT_H_GUARD
+#define __FIXED_STRING_FORMAT_H_GUARD
+
+#include <charconv>
+#include <cstdio>
+#include <type_traits>
+
+#include "fixed_string.h"
+
+
+// Format strings are checked at compile time where consteval is available, otherwise by a debug assert.
+#if defined(__cpp_consteval) && __cpp_consteval >= 201811L
+    #define FIXED_STRING_FORMAT_CONSTEVAL consteval
+    #define FIXED_STRING_HAS_CHECKED_FORMAT 1
+#else
+    #define FIXED_STRING_FORMAT_CONSTEVAL constexpr
+    #define FIXED_STRING_HAS_CHECKED_FORMAT 0
+#endif
+
+
+/// <summary>
+/// The outcome of a FormatTo call.
+/// </summary>
+struct FormatResult
+{
+    /// <summary>
+    /// Characters written, excluding the null terminator.
+    /// </summary>
+    size_t Length = 0;
+
+    /// <summary>
+    /// True if the output did not fit and was cut at the capacity.
+    /// </summary>
+    bool Truncated = false;
+};
+
+
+namespace FixedStringDetail
+{
+    /// <summary>
+    /// The categories of argument a placeholder can format. Specs are checked against these.
+    /// </summary>
+    enum class FormatArgKind : unsigned char { None, Bool, Char, Signed, Unsigned, Float, Double, String };
+
+    template<typename T>
+    struct AlwaysFalse : std::false_type {};
+
+    /// <summary>
+    /// Maps an argument type to its kind. Unsupported types fail to compile here.
+    /// </summary>
+    template<typename T>
+    constexpr FormatArgKind FormatKindOf()
+    {
+        using D = std::decay_t<T>;
+
+        if constexpr (std::is_same_v<D, bool>) return FormatArgKind::Bool;
+        else if constexpr (std::is_same_v<D, char>) return FormatArgKind::Char;
+        else if constexpr (std::is_integral_v<D> && std::is_signed_v<D>) return FormatArgKind::Signed;
+        else if constexpr (std::is_integral_v<D>) return FormatArgKind::Unsigned;
+        else if constexpr (std::is_same_v<D, float>) return FormatArgKind::Float;
+        else if constexpr (std::is_floating_point_v<D>) return FormatArgKind::Double;
+        else if constexpr (std::is_convertible_v<const T&, std::string_view>) return FormatArgKind::String;
+        else static_assert(AlwaysFalse<T>::value, "FixedString Format: unsupported argument type");
+    }
+
+    /// <summary>
+    /// One type-erased argument. The format loop is not a template, so every argument list shares it.
+    /// </summary>
+    struct FormatArg
+    {
+        FormatArgKind Kind = FormatArgKind::None;
+
+        union
+        {
+            bool B;
+            char C;
+            long long I;
+            unsigned long long U;
+            float F;
+            double D;
+            std::string_view S;
+        };
+
+        FormatArg() : U(0) {}
+    };
+
+    template<typename T>
+    FormatArg MakeFormatArg(const T& value)
+    {
+        using D = std::decay_t<T>;
+
+        FormatArg arg;
+        arg.Kind = FormatKindOf<T>();
+
+        if constexpr (std::is_same_v<D, bool>) arg.B = value;
+        else if constexpr (std::is_same_v<D, char>) arg.C = value;
+        else if constexpr (std::is_integral_v<D> && std::is_signed_v<D>) arg.I = value;
+        else if constexpr (std::is_integral_v<D>) arg.U = value;
+        else if constexpr (std::is_same_v<D, float>) arg.F = value;
+        else if constexpr (std::is_floating_point_v<D>) arg.D = static_cast<double>(value);
+        else if constexpr (std::is_array_v<T>) arg.S = std::string_view(value);
+        else if constexpr (std::is_same_v<D, const char*> || std::is_same_v<D, char*>) arg.S = std::string_view(value ? value : "");
+        else arg.S = static_cast<std::string_view>(value);
+
+        return arg;
+    }
+
+    /// <summary>
+    /// A parsed replacement field: {[:[[fill]align][0][width][.precision][type]]}.
+    /// </summary>
+    struct FormatSpec
+    {
+        char Fill = ' ';
+        char Align = '\0';              // '<', '>' or '\0' for the type's default
+        bool ZeroPad = false;
+        size_t Width = 0;
+        int Precision = -1;
+        char Type = '\0';
+    };
+
+    constexpr bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+    /// <summary>
+    /// Parses a run of at most maxDigits decimal digits. Returns false if there are more.
+    /// </summary>
+    constexpr bool ParseFormatNumber(const char*& p, const char* end, size_t maxDigits, size_t& value)
+    {
+        size_t digits = 0;
+        value = 0;
+
+        for (; p != end && IsDigit(*p); ++p, ++digits) value = value * 10 + static_cast<size_t>(*p - '0');
+
+        return digits <= maxDigits;
+    }
+
+    /// <summary>
+    /// Parses the field that starts just after '{' and advances p past the closing '}'.
+    /// Returns an error message, or nullptr on success. Shared by the compile-time check and the formatter.
+    /// </summary>
+    constexpr const char* ParseFormatSpec(const char*& p, const char* end, FormatSpec& spec)
+    {
+        if (p != end && *p == '}') { ++p; return nullptr; }
+        if (p == end || *p != ':') return "invalid replacement field; only {} and {:spec} are supported";
+
+        ++p;
+
+        if (end - p >= 2 && (p[1] == '<' || p[1] == '>') && p[0] != '{' && p[0] != '}') {
+            spec.Fill = p[0]; spec.Align = p[1]; p += 2;
+        }
+        else if (p != end && (*p == '<' || *p == '>')) {
+            spec.Align = *p++;
+        }
+
+        if (p != end && *p == '0') { spec.ZeroPad = true; ++p; }
+
+        if (!ParseFormatNumber(p, end, 3, spec.Width)) return "format width is limited to three digits";
+
+        if (p != end && *p == '.')
+        {
+            size_t precision = 0;
+            const char* digits = ++p;
+
+            if (!ParseFormatNumber(p, end, 2, precision)) return "format precision is limited to two digits";
+            if (p == digits) return "missing format precision after '.'";
+
+            spec.Precision = static_cast<int>(precision);
+        }
+
+        if (p != end && *p != '}') spec.Type = *p++;
+
+        if (p == end || *p != '}') return "invalid format spec";
+
+        ++p;
+        return nullptr;
+    }
+
+    /// <summary>
+    /// Returns an error message if the spec cannot format an argument of the given kind.
+    /// </summary>
+    constexpr const char* CheckFormatSpec(const FormatSpec& spec, FormatArgKind kind)
+    {
+        switch (kind)
+        {
+            case FormatArgKind::Signed:
+            case FormatArgKind::Unsigned:
+                if (spec.Precision >= 0) return "precision is not allowed for integers";
+                if (spec.Type != '\0' && spec.Type != 'd' && spec.Type != 'x' && spec.Type != 'X' && spec.Type != 'b' && spec.Type != 'o') {
+                    return "integers take the d, x, X, b or o format type";
+                }
+                return nullptr;
+
+            case FormatArgKind::Float:
+            case FormatArgKind::Double:
+                if (spec.Type != '\0' && spec.Type != 'f' && spec.Type != 'e' && spec.Type != 'g') return "floating-point values take the f, e or g format type";
+                return nullptr;
+
+            case FormatArgKind::String:
+                if (spec.ZeroPad) return "zero padding is not allowed for strings";
+                if (spec.Type != '\0' && spec.Type != 's') return "strings take the s format type";
+                return nullptr;
+
+            case FormatArgKind::Bool:
+            case FormatArgKind::Char:
+                if (spec.ZeroPad || spec.Precision >= 0) return "zero padding and precision are not allowed for bool or char";
+                if (spec.Type != '\0' && spec.Type != 's' && spec.Type != 'c') return "bool and char take the s or c format type";
+                return nullptr;
+
+            default:
+                return "argument type cannot be formatted";
+        }
+    }
+
+    /// <summary>
+    /// Validates a format string against the argument kinds. Returns an error message, or nullptr if valid.
+    /// </summary>
+    constexpr const char* CheckFormat(std::string_view fmt, const FormatArgKind* kinds, size_t count)
+    {
+        const char* p = fmt.data();
+        const char* end = p + fmt.size();
+        size_t next = 0;
+
+        while (p != end)
+        {
+            const char c = *p++;
+
+            if (c == '}')
+            {
+                if (p == end || *p != '}') return "unmatched '}' in format string; write }} for a literal brace";
+                ++p;
+            }
+            else if (c == '{')
+            {
+                if (p != end && *p == '{') { ++p; continue; }
+
+                FormatSpec spec;
+                if (const char* error = ParseFormatSpec(p, end, spec)) return error;
+                if (next == count) return "more placeholders than arguments";
+                if (const char* error = CheckFormatSpec(spec, kinds[next++])) return error;
+            }
+        }
+
+        return next == count ? nullptr : "more arguments than placeholders";
+    }
+
+    /// <summary>
+    /// Called when a format string fails its check inside a consteval context. Not constexpr, so the
+    /// call itself is the compile error.
+    /// </summary>
+    inline void FormatStringError(const char*) {}
+
+    /// <summary>
+    /// Writes into a bounded buffer, cutting at the capacity and remembering that it did.
+    /// </summary>
+    struct FormatSink
+    {
+        char* Out;
+        size_t Capacity;
+        size_t Length = 0;
+        bool Overflowed = false;
+
+        size_t Room() const { return Capacity - Length; }
+
+        void Write(const char* p, size_t count)
+        {
+            if (count > Room()) { count = Room(); Overflowed = true; }
+            if (count > 0) std::memcpy(Out + Length, p, count);
+            Length += count;
+        }
+
+        void Fill(char c, size_t count)
+        {
+            if (count > Room()) { count = Room(); Overflowed = true; }
+            if (count > 0) std::memset(Out + Length, c, count);
+            Length += count;
+        }
+    };
+
+    /// <summary>
+    /// Writes text padded to the spec's width. Zero padding goes after any sign.
+    /// </summary>
+    inline void WritePadded(FormatSink& sink, const FormatSpec& spec, const char* text, size_t count, char defaultAlign)
+    {
+        if (count >= spec.Width) { sink.Write(text, count); return; }
+
+        const size_t pad = spec.Width - count;
+
+        if (spec.ZeroPad && spec.Align == '\0')
+        {
+            const size_t sign = (count > 0 && (text[0] == '-' || text[0] == '+')) ? 1 : 0;
+            sink.Write(text, sign);
+            sink.Fill('0', pad);
+            sink.Write(text + sign, count - sign);
+            return;
+        }
+
+        const char align = spec.Align != '\0' ? spec.Align : defaultAlign;
+
+        if (align == '>') sink.Fill(spec.Fill, pad);
+        sink.Write(text, count);
+        if (align == '<') sink.Fill(spec.Fill, pad);
+    }
+
+    template<typename T>
+    inline void FormatInteger(FormatSink& sink, const FormatSpec& spec, T value)
+    {
+        const int base = spec.Type == 'x' || spec.Type == 'X' ? 16 : spec.Type == 'b' ? 2 : spec.Type == 'o' ? 8 : 10;
+
+        char buffer[72];                // 64 binary digits and a sign
+        const std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer), value, base);
+        const size_t count = static_cast<size_t>(result.ptr - buffer);
+
+        if (spec.Type == 'X') {
+            CaseMapAscii<true>(buffer, count);
+        }
+
+        WritePadded(sink, spec, buffer, count, '>');
+    }
+
+    template<typename T>
+    inline void FormatFloat(FormatSink& sink, const FormatSpec& spec, T value)
+    {
+        char buffer[512];               // Fixed notation of the largest double at precision 99
+        size_t count = 0;
+
+#if FIXED_STRING_FLOAT_TO_CHARS
+        std::to_chars_result result;
+
+        if (spec.Type == '\0' && spec.Precision < 0) {
+            result = std::to_chars(buffer, buffer + sizeof(buffer), value);                      // Shortest round-trip form
+        }
+        else
+        {
+            const std::chars_format format = spec.Type == 'f' ? std::chars_format::fixed : spec.Type == 'e' ? std::chars_format::scientific : std::chars_format::general;
+            result = std::to_chars(buffer, buffer + sizeof(buffer), value, format, spec.Precision < 0 ? 6 : spec.Precision);
+        }
+
+        count = static_cast<size_t>(result.ptr - buffer);
+#else
+        const char conversion = spec.Type == 'f' ? 'f' : spec.Type == 'e' ? 'e' : 'g';
+        const char format[] = { '%', '.', '*', conversion, '\0' };
+
+        const int written = spec.Type == '\0' && spec.Precision < 0 ? PrintShortest(buffer, sizeof(buffer), value)
+            : std::snprintf(buffer, sizeof(buffer), format, spec.Precision < 0 ? 6 : spec.Precision, static_cast<double>(value));
+        count = written < 0 ? 0 : std::min(static_cast<size_t>(written), sizeof(buffer) - 1);
+#endif
+
+        WritePadded(sink, spec, buffer, count, '>');
+    }
+
+    inline void FormatArgument(FormatSink& sink, const FormatSpec& spec, const FormatArg& arg)
+    {
+        switch (arg.Kind)
+        {
+            case FormatArgKind::Bool:
+                if (arg.B) WritePadded(sink, spec, "true", 4, '<');
+                else WritePadded(sink, spec, "false", 5, '<');
+                break;
+
+            case FormatArgKind::Char:
+                WritePadded(sink, spec, &arg.C, 1, '<');
+                break;
+
+            case FormatArgKind::Signed:
+                if (spec.Width == 0 && (spec.Type == '\0' || spec.Type == 'd'))              // Common case: straight into the destination
+                {
+                    const std::to_chars_result result = std::to_chars(sink.Out + sink.Length, sink.Out + sink.Capacity, arg.I);
+                    if (result.ec == std::errc()) { sink.Length = static_cast<size_t>(result.ptr - sink.Out); break; }
+                }
+                FormatInteger(sink, spec, arg.I);
+                break;
+
+            case FormatArgKind::Unsigned:
+                if (spec.Width == 0 && (spec.Type == '\0' || spec.Type == 'd'))
+                {
+                    const std::to_chars_result result = std::to_chars(sink.Out + sink.Length, sink.Out + sink.Capacity, arg.U);
+                    if (result.ec == std::errc()) { sink.Length = static_cast<size_t>(result.ptr - sink.Out); break; }
+                }
+                FormatInteger(sink, spec, arg.U);
+                break;
+
+            case FormatArgKind::Float:
+                FormatFloat(sink, spec, arg.F);
+                break;
+
+            case FormatArgKind::Double:
+                FormatFloat(sink, spec, arg.D);
+                break;
+
+            case FormatArgKind::String:
+            {
+                const size_t count = spec.Precision >= 0 ? std::min(arg.S.size(), static_cast<size_t>(spec.Precision)) : arg.S.size();
+                WritePadded(sink, spec, arg.S.data(), count, '<');
+                break;
+            }
+
+            default:
+                break;
+        }
+    }
+
+    /// <summary>
+    /// Formats into out[0, capacity) without writing a terminator. Literal runs between fields are
+    /// found with the SIMD set search and copied with one memcpy each. Malformed input that slipped
+    /// past the check (C++17 release builds) is written literally; missing arguments write nothing.
+    /// </summary>
+    inline FormatResult FormatInto(char* out, size_t capacity, std::string_view fmt, const FormatArg* args, size_t count)
+    {
+        FormatSink sink{ out, capacity };
+
+        const char* p = fmt.data();
+        const char* end = p + fmt.size();
+        size_t next = 0;
+
+        while (p != end)
+        {
+            const size_t run = FindFirstOf(p, static_cast<size_t>(end - p), "{}", static_cast<size_t>(end - p));
+
+            if (run == std::string_view::npos) { sink.Write(p, static_cast<size_t>(end - p)); break; }
+
+            sink.Write(p, run);
+            p += run;
+
+            if (p + 1 != end && p[1] == *p)                 // "{{" or "}}"
+            {
+                sink.Write(p, 1);
+                p += 2;
+                continue;
+            }
+
+            if (*p++ == '}') { sink.Write("}", 1); continue; }
+
+            FormatSpec spec;
+            const char* field = p;
+
+            if (ParseFormatSpec(p, end, spec) != nullptr) { sink.Write("{", 1); p = field; continue; }
+
+            if (next < count) {
+                FormatArgument(sink, spec, args[next++]);
+            }
+        }
+
+        return FormatResult{ sink.Length, sink.Overflowed };
+    }
+
+    /// <summary>
+    /// Stops template argument deduction through the format string parameter.
+    /// </summary>
+    template<typename T>
+    struct FormatIdentity { using Type = T; };
+}
+
+
+/// <summary>
+/// A format string checked against its argument types. Constructed implicitly from a string literal;
+/// under C++20 the check runs at compile time and a bad format string does not compile.
+/// </summary>
+/// <typeparam name="Args">The argument types the string will be used with.</typeparam>
+template<typename... Args>
+class FormatString
+{
+    public:
+        template<typename S, typename = std::enable_if_t<std::is_convertible_v<const S&, std::string_view>>>
+        FIXED_STRING_FORMAT_CONSTEVAL FormatString(const S& str) : Text(str)
+        {
+            constexpr FixedStringDetail::FormatArgKind kinds[] = { FixedStringDetail::FormatArgKind::None, FixedStringDetail::FormatKindOf<Args>()... };
+            const char* error = FixedStringDetail::CheckFormat(Text, kinds + 1, sizeof...(Args));
+
+#if FIXED_STRING_HAS_CHECKED_FORMAT
+            if (error) FixedStringDetail::FormatStringError(error);
+#else
+            assert(!error && "FixedString Format: invalid format string");
+            (void)error;
+#endif
+        }
+
+        /// <summary>
+        /// The format string text.
+        /// </summary>
+        constexpr std::string_view View() const { return Text; }
+
+    private:
+        std::string_view Text;
+};
+
+
+/// <summary>
+/// Formats arguments into an existing FixedString, replacing its contents. Writes straight into Data
+/// with std::to_chars and never allocates. Output that does not fit is cut at the capacity and
+/// reported in the result rather than asserted on.
+/// </summary>
+/// <example>
+/// FixedString&lt;128&gt; line;
+/// FormatResult r = FormatTo(line, "{} {:>6} took {:.3f} ms", method, status, elapsed);
+/// </example>
+/// <param name="out">The destination. Must not be one of the arguments.</param>
+/// <param name="fmt">The format string. "{}" formats the next argument; "{{" and "}}" are literal braces.</param>
+/// <param name="args">Integers, floating-point values, bool, char and anything convertible to std::string_view.</param>
+/// <returns>The length written and whether it was truncated.</returns>
+template<size_t N, LengthPolicy L, typename... Args>
+FormatResult FormatTo(FixedString<N, L>& out, FormatString<typename FixedStringDetail::FormatIdentity<Args>::Type...> fmt, const Args&... args)
+{
+    const FixedStringDetail::FormatArg erased[] = { FixedStringDetail::FormatArg(), FixedStringDetail::MakeFormatArg(args)... };
+
+    const FormatResult result = FixedStringDetail::FormatInto(out.Data, N - 1, fmt.View(), erased + 1, sizeof...(Args));
+    out.SetLength(result.Length, result.Truncated);
+    return result;
+}
+
+/// <summary>
+/// Formats arguments into a new FixedString. Output that does not fit is silently cut at the
+/// capacity; use FormatTo to find out whether that happened.
+/// </summary>
+/// <example>auto key = Format&lt;64&gt;("{}:{}", host, port);</example>
+/// <typeparam name="N">Buffer size of the result, including the null terminator.</typeparam>
+/// <typeparam name="L">Length policy of the result.</typeparam>
+template<size_t N, LengthPolicy L = LengthPolicy::Scan, typename... Args>
+FixedString<N, L> Format(FormatString<typename FixedStringDetail::FormatIdentity<Args>::Type...> fmt, const Args&... args)
+{
+    FixedString<N, L> out(UninitializedTag{});
+    FormatTo(out, fmt, args...);
+    return out;
+}
+
+
+
+#endif
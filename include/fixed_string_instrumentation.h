@@ -0,0 +1,286 @@
+// ============================================================================
+// TextCPP - High Performance String Utility Library
+// ----------------------------------------------------------------------------
+// File:        fixed_string_instrumentation.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+
+#ifndef __FIXED_STRING_INSTRUMENTATION_H_GUARD
+#define __FIXED_STRING_INSTRUMENTATION_H_GUARD
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <vector>
+
+#include "fixed_string_config.h"
+
+#if FIXED_STRING_INSTRUMENTATION
+#include <atomic>
+#include <mutex>
+#include <algorithm>
+#endif
+
+
+/// <summary>
+/// Aggregated instrumentation counters for one FixedString capacity, across all threads.
+/// </summary>
+struct FixedStringCapacityStats
+{
+    /// <summary>
+    /// Number of fill-ratio buckets in Histogram.
+    /// </summary>
+    static constexpr size_t HistogramBins = 16;
+
+    /// <summary>
+    /// The buffer size N these counters describe.
+    /// </summary>
+    size_t Capacity = 0;
+
+    /// <summary>
+    /// Assignments recorded: every FixedString::Assign (and so every constructor and operator= from text),
+    /// SetLength, AssignNumber, FormatTo, ConcatTo, Concat, FixedStringBuilder::ToFixedString,
+    /// FixedStringLineReader::Next and FixedStringRing::TryEmplace. Copies and in-place edits such as Trim are not assignments.
+    /// </summary>
+    uint64_t Assignments = 0;
+
+    /// <summary>
+    /// Assignments whose input did not fit and was cut at the capacity.
+    /// </summary>
+    uint64_t Truncations = 0;
+
+    /// <summary>
+    /// The longest resulting length seen.
+    /// </summary>
+    size_t MaxLength = 0;
+
+    /// <summary>
+    /// Resulting lengths bucketed by fill ratio: bucket i counts lengths in [i, i + 1) * N / HistogramBins.
+    /// </summary>
+    uint64_t Histogram[HistogramBins] = {};
+};
+
+
+#if FIXED_STRING_INSTRUMENTATION
+
+namespace FixedStringDetail
+{
+    /// <summary>
+    /// One thread's counters for one capacity. Incremented only by the owning thread; relaxed atomics let
+    /// FixedStringStats read them and ResetFixedStringStats zero them concurrently without a lock on the
+    /// hot path. Updates are read-modify-writes, so a concurrent reset is never overwritten by a stale count.
+    /// </summary>
+    struct InstrumentationCounters
+    {
+        size_t Capacity = 0;
+        std::atomic<uint64_t> Assignments{ 0 };
+        std::atomic<uint64_t> Truncations{ 0 };
+        std::atomic<uint64_t> MaxLength{ 0 };
+        std::atomic<uint64_t> Histogram[FixedStringCapacityStats::HistogramBins] = {};
+
+        static void Bump(std::atomic<uint64_t>& counter) { counter.fetch_add(1, std::memory_order_relaxed); }
+
+        /// <summary>
+        /// Raises counter to value if it is lower. Usually a single load, as the maximum rarely changes.
+        /// </summary>
+        static void Raise(std::atomic<uint64_t>& counter, uint64_t value)
+        {
+            uint64_t seen = counter.load(std::memory_order_relaxed);
+            while (value > seen && !counter.compare_exchange_weak(seen, value, std::memory_order_relaxed)) {}
+        }
+    };
+
+    /// <summary>
+    /// Process-wide list of live per-thread counters, plus the totals of threads that have exited.
+    /// Only registration, thread exit, FixedStringStats and ResetFixedStringStats take the lock.
+    /// </summary>
+    class InstrumentationRegistry
+    {
+        public:
+            static InstrumentationRegistry& Instance()
+            {
+                static InstrumentationRegistry registry;
+                return registry;
+            }
+
+            void Register(InstrumentationCounters* counters)
+            {
+                std::lock_guard<std::mutex> lock(Lock);
+                Live.push_back(counters);
+            }
+
+            /// <summary>
+            /// Folds an exiting thread's counters into the retired totals.
+            /// </summary>
+            void Retire(InstrumentationCounters* counters)
+            {
+                std::lock_guard<std::mutex> lock(Lock);
+
+                Accumulate(Retired, *counters);
+                Live.erase(std::remove(Live.begin(), Live.end(), counters), Live.end());
+            }
+
+            std::vector<FixedStringCapacityStats> Snapshot()
+            {
+                std::lock_guard<std::mutex> lock(Lock);
+
+                std::vector<FixedStringCapacityStats> out = Retired;
+                for (const InstrumentationCounters* counters : Live) Accumulate(out, *counters);
+
+                std::sort(out.begin(), out.end(), [](const FixedStringCapacityStats& a, const FixedStringCapacityStats& b) { return a.Capacity < b.Capacity; });
+                return out;
+            }
+
+            void Reset()
+            {
+                std::lock_guard<std::mutex> lock(Lock);
+
+                Retired.clear();
+
+                for (InstrumentationCounters* counters : Live)
+                {
+                    counters->Assignments.store(0, std::memory_order_relaxed);
+                    counters->Truncations.store(0, std::memory_order_relaxed);
+                    counters->MaxLength.store(0, std::memory_order_relaxed);
+                    for (auto& bin : counters->Histogram) bin.store(0, std::memory_order_relaxed);
+                }
+            }
+
+        private:
+            static void Accumulate(std::vector<FixedStringCapacityStats>& totals, const InstrumentationCounters& counters)
+            {
+                auto it = std::find_if(totals.begin(), totals.end(), [&](const FixedStringCapacityStats& s) { return s.Capacity == counters.Capacity; });
+
+                if (it == totals.end()) {
+                    it = totals.insert(totals.end(), FixedStringCapacityStats{});
+                    it->Capacity = counters.Capacity;
+                }
+
+                it->Assignments += counters.Assignments.load(std::memory_order_relaxed);
+                it->Truncations += counters.Truncations.load(std::memory_order_relaxed);
+                it->MaxLength = std::max<size_t>(it->MaxLength, static_cast<size_t>(counters.MaxLength.load(std::memory_order_relaxed)));
+
+                for (size_t b = 0; b < FixedStringCapacityStats::HistogramBins; ++b) {
+                    it->Histogram[b] += counters.Histogram[b].load(std::memory_order_relaxed);
+                }
+            }
+
+            std::mutex Lock;
+            std::vector<InstrumentationCounters*> Live;
+            std::vector<FixedStringCapacityStats> Retired;
+    };
+
+    /// <summary>
+    /// Counters for capacity N on the calling thread, registered on first use and retired at thread exit.
+    /// </summary>
+    template<size_t N>
+    struct ThreadCounters : InstrumentationCounters
+    {
+        ThreadCounters() { Capacity = N; InstrumentationRegistry::Instance().Register(this); }
+        ~ThreadCounters() { InstrumentationRegistry::Instance().Retire(this); }
+
+        static ThreadCounters& Local()
+        {
+            thread_local ThreadCounters counters;
+            return counters;
+        }
+    };
+
+    inline namespace FIXED_STRING_ABI
+    {
+
+    /// <summary>
+    /// Records one assignment into a buffer of N bytes that produced length characters.
+    /// </summary>
+    template<size_t N>
+    inline void RecordAssign(size_t length, bool truncated)
+    {
+        InstrumentationCounters& counters = ThreadCounters<N>::Local();
+
+        InstrumentationCounters::Bump(counters.Assignments);
+        if (truncated) InstrumentationCounters::Bump(counters.Truncations);
+
+        InstrumentationCounters::Raise(counters.MaxLength, length);
+        InstrumentationCounters::Bump(counters.Histogram[length * FixedStringCapacityStats::HistogramBins / N]);
+    }
+
+    }
+}
+
+
+inline namespace FIXED_STRING_ABI
+{
+
+/// <summary>
+/// Returns the counters of every FixedString capacity used so far, summed over all threads, by capacity.
+/// </summary>
+inline std::vector<FixedStringCapacityStats> FixedStringStats() { return FixedStringDetail::InstrumentationRegistry::Instance().Snapshot(); }
+
+/// <summary>
+/// Zeroes every counter.
+/// </summary>
+inline void ResetFixedStringStats() { FixedStringDetail::InstrumentationRegistry::Instance().Reset(); }
+
+}
+
+#else
+
+namespace FixedStringDetail
+{
+    inline namespace FIXED_STRING_ABI
+    {
+
+    template<size_t N>
+    inline void RecordAssign(size_t, bool) {}
+
+    }
+}
+
+inline namespace FIXED_STRING_ABI
+{
+
+inline std::vector<FixedStringCapacityStats> FixedStringStats() { return {}; }
+inline void ResetFixedStringStats() {}
+
+}
+
+#endif
+
+
+inline namespace FIXED_STRING_ABI
+{
+
+/// <summary>
+/// Writes FixedStringStats() as text, one capacity per line with its fill-ratio histogram.
+/// Writes nothing when instrumentation is disabled.
+/// </summary>
+inline void DumpFixedStringStats(std::FILE* out = stderr)
+{
+    for (const FixedStringCapacityStats& stats : FixedStringStats())
+    {
+        std::fprintf(out, "FixedString<%zu>: %llu assignments, %llu truncated, max length %zu, fill histogram [", stats.Capacity,
+            static_cast<unsigned long long>(stats.Assignments), static_cast<unsigned long long>(stats.Truncations), stats.MaxLength);
+
+        for (size_t b = 0; b < FixedStringCapacityStats::HistogramBins; ++b) {
+            std::fprintf(out, b ? " %llu" : "%llu", static_cast<unsigned long long>(stats.Histogram[b]));
+        }
+
+        std::fputs("]\n", out);
+    }
+}
+
+}
+
+
+
+#endif
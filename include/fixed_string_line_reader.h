@@ -0,0 +1,188 @@
+// ============================================================================
+// TextCPP - High Performance String Utility Library
+// ----------------------------------------------------------------------------
+// File:        fixed_string_line_reader.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+
+#ifndef __FIXED_STRING_LINE_READER_H_GUARD
+#define __FIXED_STRING_LINE_READER_H_GUARD
+
+#include <cstdio>
+#include <vector>
+
+#include "fixed_string.h"
+
+
+/// <summary>
+/// Splits newline-delimited text into lines without allocating per line.
+/// Reads either from memory the caller already holds, such as a memory-mapped file, where every line is a
+/// view into that memory, or from a FILE* in large blocks through one reusable buffer. Newlines are found
+/// with the SIMD character search. A line ends at "\n"; a "\r" before it is dropped, and a final line
+/// without a newline is still returned.
+/// </summary>
+/// <remarks>
+/// Lines assigned into a FixedString that do not fit are cut at N - 1 characters and counted in
+/// Truncations(); they never assert. A line views the reader's buffer and is valid until the next read.
+/// </remarks>
+class FixedStringLineReader
+{
+    public:
+        /// <summary>
+        /// Reads lines from text, which must outlive the reader. Nothing is copied.
+        /// </summary>
+        explicit FixedStringLineReader(std::string_view text) : Begin(text.data()), End(text.data() + text.size()) {}
+
+        /// <summary>
+        /// Reads lines from an open file, blockSize bytes at a time. The file is not closed by the reader.
+        /// The buffer grows only to hold a line longer than blockSize.
+        /// </summary>
+        explicit FixedStringLineReader(std::FILE* file, size_t blockSize = 1 << 20) : File(file), Buffer(blockSize > 0 ? blockSize : 1)
+        {
+            Begin = End = Buffer.data();
+        }
+
+        FixedStringLineReader(const FixedStringLineReader&) = delete;
+        FixedStringLineReader& operator=(const FixedStringLineReader&) = delete;
+
+        /// <summary>
+        /// Reads the next line, without its line ending.
+        /// </summary>
+        /// <returns>False at the end of the input; line is unchanged.</returns>
+        bool Next(std::string_view& line)
+        {
+            for (;;)
+            {
+                const size_t available = static_cast<size_t>(End - Begin);
+                const size_t pos = FixedStringDetail::FindChar(Begin + Searched, available - Searched, '\n', available - Searched);
+
+                if (pos != std::string_view::npos) {
+                    line = TakeLine(Searched + pos, Searched + pos + 1);
+                    return true;
+                }
+
+                Searched = available;                           // Only the bytes still to be read need searching
+
+                if (!Refill())
+                {
+                    if (available == 0) return false;
+
+                    line = TakeLine(available, available);      // Last line, with no newline
+                    return true;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Reads the next line into out. A line longer than N - 1 characters is cut and counted in Truncations().
+        /// </summary>
+        /// <returns>False at the end of the input; out is unchanged.</returns>
+        template<size_t N, LengthPolicy L>
+        bool Next(FixedString<N, L>& out)
+        {
+            std::string_view line;
+            if (!Next(line)) return false;
+
+            const bool truncated = line.size() >= N;
+
+            if (truncated)
+            {
+                ++TruncatedLines;
+                line = line.substr(0, N - 1);
+            }
+
+            FixedStringDetail::CopyBytes(out.Data, line.data(), line.size());
+            out.SetLength(line.size(), truncated);              // Assign of the cut line would not report the cut
+            return true;
+        }
+
+        /// <summary>
+        /// Fills up to count consecutive records, one line each.
+        /// </summary>
+        /// <returns>The number of records filled; fewer than count only at the end of the input.</returns>
+        template<size_t N, LengthPolicy L>
+        size_t ReadInto(FixedString<N, L>* out, size_t count)
+        {
+            size_t filled = 0;
+            while (filled < count && Next(out[filled])) ++filled;
+            return filled;
+        }
+
+        /// <summary>
+        /// Number of lines returned so far.
+        /// </summary>
+        uint64_t Lines() const { return LineCount; }
+
+        /// <summary>
+        /// Number of lines cut to fit a FixedString.
+        /// </summary>
+        uint64_t Truncations() const { return TruncatedLines; }
+
+        /// <summary>
+        /// True if reading the file failed. The lines before the failure were returned normally.
+        /// </summary>
+        bool Error() const { return File && std::ferror(File) != 0; }
+
+    private:
+        /// <summary>
+        /// Returns the first len bytes as a line, without a trailing "\r", and consumes skip bytes.
+        /// </summary>
+        std::string_view TakeLine(size_t len, size_t skip)
+        {
+            if (len > 0 && Begin[len - 1] == '\r') --len;
+
+            const std::string_view line(Begin, len);
+            Begin += skip;
+            Searched = 0;
+            ++LineCount;
+            return line;
+        }
+
+        /// <summary>
+        /// Moves the unread bytes to the front of the buffer and reads another block after them.
+        /// </summary>
+        /// <returns>False if there is no more input.</returns>
+        bool Refill()
+        {
+            if (!File || std::feof(File) || std::ferror(File)) return false;
+
+            const size_t kept = static_cast<size_t>(End - Begin);
+            const size_t offset = static_cast<size_t>(Begin - Buffer.data());
+
+            if (kept > 0 && offset > 0) {
+                std::memmove(Buffer.data(), Buffer.data() + offset, kept);
+            }
+
+            if (kept == Buffer.size()) {
+                Buffer.resize(Buffer.size() * 2);               // One line fills the buffer
+            }
+
+            const size_t read = std::fread(Buffer.data() + kept, 1, Buffer.size() - kept, File);
+
+            Begin = Buffer.data();
+            End = Begin + kept + read;
+            return read > 0;
+        }
+
+        std::FILE* File = nullptr;
+        std::vector<char> Buffer;
+        const char* Begin = nullptr;
+        const char* End = nullptr;
+        size_t Searched = 0;
+        uint64_t LineCount = 0;
+        uint64_t TruncatedLines = 0;
+};
+
+
+
+#endif
@@ -0,0 +1,386 @@
+// ============================================================================
+// TextCPP - High Performance String Utility Library
+// ----------------------------------------------------------------------------
+// File:        fixed_string_matcher.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+
+#ifndef __FIXED_STRING_MATCHER_H_GUARD
+#define __FIXED_STRING_MATCHER_H_GUARD
+
+#include <vector>
+#include <iterator>
+#include <initializer_list>
+
+#include "fixed_string.h"
+
+
+/// <summary>
+/// One occurrence of a pattern in a scanned text.
+/// </summary>
+struct MatcherHit
+{
+    /// <summary>
+    /// The pattern's id: its position in the order the patterns were added.
+    /// </summary>
+    uint32_t Id;
+
+    /// <summary>
+    /// Where the occurrence starts in the text.
+    /// </summary>
+    size_t Position;
+};
+
+
+/// <summary>
+/// Finds every occurrence of a set of patterns in one pass over a text (Aho-Corasick).
+/// Build compiles the patterns into a deterministic automaton over byte classes, so scanning costs one
+/// table lookup per input byte however many patterns there are, and never allocates. While no match is
+/// in progress and the patterns start with at most four distinct bytes, the scan skips ahead to the next
+/// such byte with the SIMD search used by FindFirstOf.
+/// </summary>
+/// <example>
+/// FixedStringMatcher blocklist({ "drop table", "&lt;script", "../" });
+/// if (blocklist.Contains(line)) Reject(line);
+/// </example>
+/// <remarks>
+/// Overlapping occurrences and occurrences of patterns contained in other patterns are all reported.
+/// Matching is byte-exact. Build may be called again after adding more patterns.
+/// </remarks>
+class FixedStringMatcher
+{
+    public:
+        FixedStringMatcher() = default;
+
+        /// <summary>
+        /// Adds every pattern and builds the automaton.
+        /// </summary>
+        FixedStringMatcher(std::initializer_list<std::string_view> patterns)
+        {
+            for (std::string_view pattern : patterns) Add(pattern);
+            Build();
+        }
+
+        /// <summary>
+        /// Adds every element of a container of string-like patterns (FixedString, std::string,
+        /// std::string_view, const char*) and builds the automaton.
+        /// </summary>
+        template<typename Range, typename = decltype(std::begin(std::declval<const Range&>()))>
+        explicit FixedStringMatcher(const Range& patterns)
+        {
+            for (const auto& pattern : patterns) Add(FixedStringDetail::KeyView(pattern));
+            Build();
+        }
+
+        /// <summary>
+        /// Returned by Add for a pattern it rejects.
+        /// </summary>
+        static constexpr uint32_t NoPattern = static_cast<uint32_t>(-1);
+
+        /// <summary>
+        /// Adds a pattern. It takes effect at the next Build. An empty pattern would match everywhere and
+        /// has no first byte to search for, so it asserts in debug builds and is not added in release builds.
+        /// </summary>
+        /// <param name="pattern">The pattern. Must not be empty.</param>
+        /// <returns>The pattern's id, reported with each of its matches, or NoPattern if pattern is empty.</returns>
+        uint32_t Add(std::string_view pattern)
+        {
+            assert(!pattern.empty() && "FixedStringMatcher: patterns must not be empty");
+            if (pattern.empty()) return NoPattern;
+
+            PatternBytes.append(pattern.data(), pattern.size());
+            PatternEnds.push_back(static_cast<uint32_t>(PatternBytes.size()));
+            Built = false;
+
+            return static_cast<uint32_t>(PatternEnds.size() - 1);
+        }
+
+        /// <summary>
+        /// Compiles the added patterns. Required before scanning.
+        /// </summary>
+        void Build()
+        {
+            BuildClasses();
+            BuildTrie();
+            BuildLinks();
+            BuildSkipSet();
+            Built = true;
+        }
+
+        /// <summary>
+        /// Calls visit(MatcherHit) for every occurrence, in order of where the occurrences end.
+        /// </summary>
+        template<typename Visitor>
+        void Scan(std::string_view text, Visitor&& visit) const
+        {
+            Run(text, [&visit](uint32_t id, size_t position) { visit(MatcherHit{ id, position }); return true; });
+        }
+
+        /// <summary>
+        /// Returns the occurrence that ends first, or nullopt. Stops scanning there.
+        /// </summary>
+        std::optional<MatcherHit> FindFirst(std::string_view text) const
+        {
+            std::optional<MatcherHit> hit;
+            Run(text, [&hit](uint32_t id, size_t position) { hit = MatcherHit{ id, position }; return false; });
+            return hit;
+        }
+
+        /// <summary>
+        /// True if any pattern occurs in text. Stops scanning at the first occurrence.
+        /// </summary>
+        bool Contains(std::string_view text) const { return FindFirst(text).has_value(); }
+
+        /// <summary>
+        /// Counts all occurrences of all patterns.
+        /// </summary>
+        size_t Count(std::string_view text) const
+        {
+            size_t count = 0;
+            Run(text, [&count](uint32_t, size_t) { ++count; return true; });
+            return count;
+        }
+
+        /// <summary>
+        /// Returns the pattern with the given id.
+        /// </summary>
+        std::string_view Pattern(uint32_t id) const
+        {
+            assert(id < PatternEnds.size() && "FixedStringMatcher: id out of range");
+
+            const uint32_t begin = id > 0 ? PatternEnds[id - 1] : 0;
+            return std::string_view(PatternBytes.data() + begin, PatternEnds[id] - begin);
+        }
+
+        /// <summary>
+        /// The number of patterns added.
+        /// </summary>
+        size_t size() const { return PatternEnds.size(); }
+
+        /// <summary>
+        /// The number of automaton states, a measure of its memory: each costs one transition per byte class.
+        /// </summary>
+        size_t StateCount() const { return States.size(); }
+
+    private:
+        static constexpr uint32_t OutputFlag = 0x80000000u;     // Set on a transition whose target reports matches
+        static constexpr uint32_t NoState = 0xFFFFFFFFu;
+
+        struct State
+        {
+            uint32_t MatchBegin = 0;                            // Ids ending exactly here: MatchIds[MatchBegin, MatchEnd)
+            uint32_t MatchEnd = 0;
+            uint32_t OutputLink = NoState;                      // Nearest proper suffix state that has matches
+        };
+
+        /// <summary>
+        /// The automaton loop. onMatch(id, position) returns false to stop.
+        /// </summary>
+        template<typename OnMatch>
+        void Run(std::string_view text, OnMatch&& onMatch) const
+        {
+            assert(Built && "FixedStringMatcher: Build must be called before scanning");
+
+            const char* p = text.data();
+            const size_t len = text.size();
+            uint32_t row = 0;
+
+            for (size_t i = 0; i < len; ++i)
+            {
+                if (row == 0 && !SkipSet.empty())               // Nothing in progress: jump to a possible start
+                {
+                    const size_t next = FixedStringDetail::FindFirstOf(p + i, len - i, SkipSet, len - i);
+                    if (next == std::string_view::npos) return;
+                    i += next;
+                }
+
+                const uint32_t target = Transitions[row + ByteClass[static_cast<unsigned char>(p[i])]];
+                row = target & ~OutputFlag;
+
+                if ((target & OutputFlag) && !Report(row / ClassCount, i, onMatch)) return;
+            }
+        }
+
+        /// <summary>
+        /// Reports every pattern ending at text position end in the given state and its output links.
+        /// </summary>
+        template<typename OnMatch>
+        bool Report(uint32_t state, size_t end, OnMatch& onMatch) const
+        {
+            for (; state != NoState; state = States[state].OutputLink)
+            {
+                for (uint32_t m = States[state].MatchBegin; m < States[state].MatchEnd; ++m)
+                {
+                    const uint32_t id = MatchIds[m];
+                    if (!onMatch(id, end + 1 - Pattern(id).size())) return false;
+                }
+            }
+
+            return true;
+        }
+
+        /// <summary>
+        /// Class 0 is every byte no pattern uses; each byte that some pattern uses gets its own class.
+        /// </summary>
+        void BuildClasses()
+        {
+            std::fill(std::begin(ByteClass), std::end(ByteClass), uint16_t(0));
+            ClassCount = 1;
+
+            bool used[256] = {};
+            for (char c : PatternBytes) used[static_cast<unsigned char>(c)] = true;
+
+            for (size_t b = 0; b < 256; ++b)
+            {
+                if (used[b]) ByteClass[b] = static_cast<uint16_t>(ClassCount++);
+            }
+        }
+
+        uint32_t AddState()
+        {
+            States.emplace_back();
+            Transitions.resize(Transitions.size() + ClassCount, NoState);
+            return static_cast<uint32_t>(States.size() - 1);
+        }
+
+        /// <summary>
+        /// Inserts every pattern into a trie whose rows are the transition table, and groups the ids by end state.
+        /// </summary>
+        void BuildTrie()
+        {
+            States.clear();
+            Transitions.clear();
+            MatchIds.clear();
+            AddState();
+
+            std::vector<uint32_t> endState(PatternEnds.size());
+
+            for (uint32_t id = 0; id < PatternEnds.size(); ++id)
+            {
+                uint32_t state = 0;
+
+                for (char c : Pattern(id))
+                {
+                    const size_t slot = state * ClassCount + ByteClass[static_cast<unsigned char>(c)];
+
+                    if (Transitions[slot] == NoState)
+                    {
+                        const uint32_t created = AddState();        // Resizes Transitions
+                        Transitions[slot] = created;
+                    }
+
+                    state = Transitions[slot];
+                }
+
+                endState[id] = state;
+            }
+
+            std::vector<uint32_t> counts(States.size() + 1, 0);
+            for (uint32_t state : endState) ++counts[state + 1];
+            for (size_t s = 1; s < counts.size(); ++s) counts[s] += counts[s - 1];
+
+            for (size_t s = 0; s < States.size(); ++s) {
+                States[s].MatchBegin = States[s].MatchEnd = counts[s];
+            }
+
+            MatchIds.resize(endState.size());
+            for (uint32_t id = 0; id < endState.size(); ++id) MatchIds[States[endState[id]].MatchEnd++] = id;
+        }
+
+        /// <summary>
+        /// Breadth-first pass that computes failure links, fills every missing transition from the failure
+        /// state (making the table a DFA), links each state to its nearest matching suffix, and finally
+        /// pre-multiplies the targets into row offsets and flags the ones that report.
+        /// </summary>
+        void BuildLinks()
+        {
+            std::vector<uint32_t> fail(States.size(), 0);
+            std::vector<uint32_t> queue;
+            queue.reserve(States.size());
+
+            for (size_t c = 0; c < ClassCount; ++c)
+            {
+                uint32_t& next = Transitions[c];
+
+                if (next == NoState) next = 0;
+                else queue.push_back(next);
+            }
+
+            for (size_t head = 0; head < queue.size(); ++head)
+            {
+                const uint32_t state = queue[head];
+                const uint32_t link = fail[state];
+
+                States[state].OutputLink = States[link].MatchEnd > States[link].MatchBegin ? link : States[link].OutputLink;
+
+                for (size_t c = 0; c < ClassCount; ++c)
+                {
+                    uint32_t& next = Transitions[state * ClassCount + c];
+
+                    if (next == NoState) {
+                        next = Transitions[link * ClassCount + c];
+                    }
+                    else {
+                        fail[next] = Transitions[link * ClassCount + c];
+                        queue.push_back(next);
+                    }
+                }
+            }
+
+            for (uint32_t& target : Transitions)
+            {
+                const State& s = States[target];
+                const bool reports = s.MatchEnd > s.MatchBegin || s.OutputLink != NoState;
+                target = target * ClassCount | (reports ? OutputFlag : 0);
+            }
+
+            assert(States.size() * ClassCount < OutputFlag && "FixedStringMatcher: automaton too large");
+        }
+
+        /// <summary>
+        /// The distinct first bytes of the patterns, if there are few enough to search for with SIMD.
+        /// </summary>
+        void BuildSkipSet()
+        {
+            SkipSet.clear();
+
+            bool seen[256] = {};
+
+            for (uint32_t id = 0; id < PatternEnds.size(); ++id)
+            {
+                const unsigned char first = static_cast<unsigned char>(Pattern(id)[0]);
+
+                if (!seen[first])
+                {
+                    seen[first] = true;
+                    SkipSet.push_back(static_cast<char>(first));
+                }
+            }
+
+            if (SkipSet.size() > 4) SkipSet.clear();
+        }
+
+        std::string PatternBytes;                               // All patterns, back to back
+        std::vector<uint32_t> PatternEnds;
+        std::vector<uint32_t> Transitions;                      // ClassCount entries per state, as row offsets
+        std::vector<State> States;
+        std::vector<uint32_t> MatchIds;
+        std::string SkipSet;
+        uint16_t ByteClass[256] = {};
+        size_t ClassCount = 1;
+        bool Built = false;
+};
+
+
+
+#endif
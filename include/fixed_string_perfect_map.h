@@ -0,0 +1,277 @@
+// ============================================================================
+// TextCPP - High Performance String Utility Library
+// ----------------------------------------------------------------------------
+// File:        fixed_string_perfect_map.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+
+#ifndef __FIXED_STRING_PERFECT_MAP_H_GUARD
+#define __FIXED_STRING_PERFECT_MAP_H_GUARD
+
+#include <optional>
+#include <utility>
+
+#include "fixed_string.h"
+
+
+namespace FixedStringDetail
+{
+    /// <summary>
+    /// Reports that no perfect hash was found and aborts. Not constexpr on purpose: reaching it while a
+    /// constexpr map is built makes the declaration ill-formed, so the failure is a compile error.
+    /// </summary>
+    [[noreturn]] inline void PerfectMapBuildFailed()
+    {
+        std::fprintf(stderr, "FixedStringPerfectMap: no perfect hash found for the key set\n");
+        std::abort();
+    }
+
+    /// <summary>
+    /// Reports a key too long for the map's KeyN and aborts. Not constexpr, like PerfectMapBuildFailed, so
+    /// an over-long key in a constexpr map is a compile error rather than a silently truncated key.
+    /// </summary>
+    [[noreturn]] inline void PerfectMapKeyTooLong()
+    {
+        std::fprintf(stderr, "FixedStringPerfectMap: key exceeds KeyN - 1 characters\n");
+        std::abort();
+    }
+}
+
+
+/// <summary>
+/// An immutable string-keyed map built over a fixed key set with a collision-free (perfect) hash.
+/// A lookup is one FixedString hash, one table index and one length-checked compare against the
+/// stored key; it never probes. Under C++20 the table is built entirely at compile time when the
+/// map is declared constexpr, otherwise it is built once during initialization.
+/// </summary>
+/// <remarks>
+/// Construction uses hash-and-displace: keys are grouped into buckets by the high half of their hash,
+/// and each bucket, largest first, is given a small pilot value that moves all of its keys into free
+/// slots. The table has at least twice as many slots as keys, so pilots are found in a few tries.
+/// Duplicate keys keep the first value.
+/// </remarks>
+/// <typeparam name="Value">The mapped type. Must be default-constructible and copyable; a literal type for constexpr use.</typeparam>
+/// <typeparam name="Count">The number of keys.</typeparam>
+/// <typeparam name="KeyN">Buffer size of each stored key, including the null terminator. At most 256.</typeparam>
+template<typename Value, size_t Count, size_t KeyN = 32>
+class FixedStringPerfectMap
+{
+    static_assert(Count > 0, "FixedStringPerfectMap requires at least one key");
+
+    public:
+        /// <summary>
+        /// One key and its value, as passed to the constructor.
+        /// </summary>
+        using Item = std::pair<std::string_view, Value>;
+
+        /// <summary>
+        /// Number of slots in the table: the smallest power of two holding twice the keys.
+        /// </summary>
+        static constexpr size_t TableSize = []() { size_t size = 1; while (size < Count * 2) size <<= 1; return size; }();
+
+        /// <summary>
+        /// Number of displacement buckets, about two keys per bucket.
+        /// </summary>
+        static constexpr size_t BucketCount = Count / 2 + 1;
+
+        /// <summary>
+        /// Builds the table from a list of keys and values. If no perfect hash is found, which takes a
+        /// pathological key set, a constexpr map fails to compile and a runtime map aborts with a message,
+        /// in release builds too, rather than answering lookups from a partial table. A key of KeyN or
+        /// more characters fails the same way, since storing it truncated would make it unreachable.
+        /// </summary>
+        /// <param name="items">The keys and values. Every key must be shorter than KeyN.</param>
+        FIXED_STRING_CONSTEXPR explicit FixedStringPerfectMap(const Item (&items)[Count])
+        {
+            for (size_t i = 0; i < Count; ++i)
+            {
+                if (items[i].first.size() >= KeyN) FixedStringDetail::PerfectMapKeyTooLong();
+            }
+
+            for (uint64_t seed = 0; seed < MaxSeed; ++seed)
+            {
+                if (TryBuild(items, seed)) {
+                    return;
+                }
+            }
+
+            FixedStringDetail::PerfectMapBuildFailed();
+        }
+
+        /// <summary>
+        /// Looks up a key.
+        /// </summary>
+        /// <param name="key">The probe. Any string view; it does not need to be null-terminated.</param>
+        /// <returns>The value, or std::nullopt if the key is not in the map.</returns>
+        FIXED_STRING_CONSTEXPR std::optional<Value> Find(std::string_view key) const
+        {
+            const size_t slot = SlotOf(key);
+
+            if (Occupied[slot] && Keys[slot] == key) {
+                return Values[slot];
+            }
+
+            return std::nullopt;
+        }
+
+        /// <summary>
+        /// Returns true if the key is in the map.
+        /// </summary>
+        FIXED_STRING_CONSTEXPR bool Contains(std::string_view key) const
+        {
+            const size_t slot = SlotOf(key);
+            return Occupied[slot] && Keys[slot] == key;
+        }
+
+        /// <summary>
+        /// Returns the number of distinct keys.
+        /// </summary>
+        constexpr size_t size() const { return Size; }
+
+    private:
+        static constexpr uint32_t MaxPilot = 1u << 16;
+        static constexpr uint64_t MaxSeed = 64;
+
+        static constexpr size_t BucketOf(uint64_t hash) { return static_cast<size_t>(((hash >> 32) * BucketCount) >> 32); }
+
+        static constexpr size_t SlotFor(uint64_t hash, uint32_t pilot)
+        {
+            uint64_t x = hash ^ (pilot * 0x9E3779B97F4A7C15ull);
+            x ^= x >> 31;
+            x *= 0xBF58476D1CE4E5B9ull;
+            x ^= x >> 29;
+            return static_cast<size_t>(x) & (TableSize - 1);
+        }
+
+        FIXED_STRING_CONSTEXPR size_t SlotOf(std::string_view key) const
+        {
+            const uint64_t hash = FixedStringDetail::Hash64(key.data(), key.size(), Seed);
+            return SlotFor(hash, Pilots[BucketOf(hash)]);
+        }
+
+        /// <summary>
+        /// Attempts to place every key with the given hash seed. Returns false if some bucket has no
+        /// pilot within MaxPilot, in which case the caller retries with another seed.
+        /// </summary>
+        FIXED_STRING_CONSTEXPR bool TryBuild(const Item (&items)[Count], uint64_t seed)
+        {
+            uint64_t hashes[Count] = {};
+            bool skip[Count] = {};
+            size_t bucketSize[BucketCount] = {};
+            size_t order[BucketCount] = {};
+
+            Seed = seed;
+            Size = 0;
+
+            for (size_t i = 0; i < TableSize; ++i) Occupied[i] = false;
+            for (size_t b = 0; b < BucketCount; ++b) Pilots[b] = 0;
+
+            for (size_t i = 0; i < Count; ++i)
+            {
+                hashes[i] = FixedStringDetail::Hash64(items[i].first.data(), items[i].first.size(), seed);
+
+                for (size_t j = 0; j < i && !skip[i]; ++j)                  // Drop later duplicates of a key
+                {
+                    if (!skip[j] && hashes[j] == hashes[i] && items[j].first == items[i].first) {
+                        skip[i] = true;
+                    }
+                }
+
+                if (!skip[i]) {
+                    ++bucketSize[BucketOf(hashes[i])];
+                    ++Size;
+                }
+            }
+
+            for (size_t b = 0; b < BucketCount; ++b)                        // Largest buckets are placed first
+            {
+                size_t at = b;
+                while (at > 0 && bucketSize[order[at - 1]] < bucketSize[b]) { order[at] = order[at - 1]; --at; }
+                order[at] = b;
+            }
+
+            for (size_t o = 0; o < BucketCount && bucketSize[order[o]] > 0; ++o)
+            {
+                const size_t bucket = order[o];
+                uint32_t pilot = 0;
+
+                for (; pilot < MaxPilot; ++pilot)
+                {
+                    if (PilotFits(hashes, skip, bucket, pilot)) break;
+                }
+
+                if (pilot == MaxPilot) return false;
+
+                Pilots[bucket] = pilot;
+
+                for (size_t i = 0; i < Count; ++i)
+                {
+                    if (skip[i] || BucketOf(hashes[i]) != bucket) continue;
+
+                    const size_t slot = SlotFor(hashes[i], pilot);
+                    Occupied[slot] = true;
+                    Keys[slot].Assign(items[i].first);
+                    Values[slot] = items[i].second;
+                }
+            }
+
+            return true;
+        }
+
+        /// <summary>
+        /// True if every key in the bucket lands on a free slot, and on distinct slots, under pilot.
+        /// </summary>
+        FIXED_STRING_CONSTEXPR bool PilotFits(const uint64_t (&hashes)[Count], const bool (&skip)[Count], size_t bucket, uint32_t pilot) const
+        {
+            for (size_t i = 0; i < Count; ++i)
+            {
+                if (skip[i] || BucketOf(hashes[i]) != bucket) continue;
+
+                const size_t slot = SlotFor(hashes[i], pilot);
+                if (Occupied[slot]) return false;
+
+                for (size_t j = 0; j < i; ++j)
+                {
+                    if (!skip[j] && BucketOf(hashes[j]) == bucket && SlotFor(hashes[j], pilot) == slot) return false;
+                }
+            }
+
+            return true;
+        }
+
+        FixedString<KeyN, LengthPolicy::Stored> Keys[TableSize];
+        Value Values[TableSize] = {};
+        bool Occupied[TableSize] = {};
+        uint32_t Pilots[BucketCount] = {};
+        uint64_t Seed = 0;
+        size_t Size = 0;
+};
+
+
+/// <summary>
+/// Builds a FixedStringPerfectMap, deducing the key count from the initializer.
+/// </summary>
+/// <example>
+/// constexpr auto kMethods = MakeFixedStringPerfectMap&lt;Method&gt;({ { "GET", Method::Get }, { "PUT", Method::Put } });
+/// </example>
+/// <typeparam name="Value">The mapped type.</typeparam>
+/// <typeparam name="KeyN">Buffer size of each stored key, including the null terminator.</typeparam>
+template<typename Value, size_t KeyN = 32, size_t Count>
+FIXED_STRING_CONSTEXPR FixedStringPerfectMap<Value, Count, KeyN> MakeFixedStringPerfectMap(const std::pair<std::string_view, Value> (&items)[Count])
+{
+    return FixedStringPerfectMap<Value, Count, KeyN>(items);
+}
+
+
+
+#endif
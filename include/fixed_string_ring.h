@@ -0,0 +1,251 @@
+// ============================================================================
+// TextCPP - High Performance String Utility Library
+// ----------------------------------------------------------------------------
+// File:        fixed_string_ring.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+
+#ifndef __FIXED_STRING_RING_H_GUARD
+#define __FIXED_STRING_RING_H_GUARD
+
+#include <atomic>
+
+#include "fixed_string.h"
+
+
+/// <summary>
+/// How many threads may push into a FixedStringRing at once.
+/// </summary>
+enum class RingProducers
+{
+    /// <summary>
+    /// One producer thread. A push is two loads and two stores, with no read-modify-write.
+    /// </summary>
+    Single,
+
+    /// <summary>
+    /// Any number of producer threads. Producers claim slots with a compare-exchange on the tail.
+    /// </summary>
+    Multi
+};
+
+
+/// <summary>
+/// A bounded lock-free queue of strings from producer threads to one consumer thread.
+/// Each slot holds a sequence number, the length and an N-byte buffer inline, aligned to its own cache line,
+/// so a message is written once into its slot, read once out of it, and no two slots share a line.
+/// TryEmplace lets a producer format directly into the slot. Consumers receive a std::string_view of
+/// the stored length and never scan for the terminator; Drain hands over every ready message in one call.
+/// </summary>
+/// <remarks>
+/// Each slot carries a sequence number (the bounded queue design of D. Vyukov): a producer owns a slot
+/// once its sequence equals the producer's position, and publishes it by advancing the sequence, so the
+/// consumer never reads a slot whose text is still being written. The ring never allocates; it is large
+/// (Capacity cache-line-rounded slots), so give it static or heap storage rather than a thread's stack.
+/// </remarks>
+/// <typeparam name="N">Buffer size of each message, including the null terminator.</typeparam>
+/// <typeparam name="Capacity">Number of slots. Must be a power of two.</typeparam>
+/// <typeparam name="P">Whether one or several threads push. See RingProducers.</typeparam>
+template<size_t N, size_t Capacity, RingProducers P = RingProducers::Single>
+class FixedStringRing
+{
+    static_assert(N > 0, "FixedStringRing: N must be > 0");
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "FixedStringRing: Capacity must be a power of two");
+
+    public:
+        FixedStringRing()
+        {
+            for (size_t i = 0; i < Capacity; ++i) {
+                Slots[i].Sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        FixedStringRing(const FixedStringRing&) = delete;
+        FixedStringRing& operator=(const FixedStringRing&) = delete;
+
+        /// <summary>
+        /// Queues a copy of sv. Like FixedString::Assign, asserts in debug builds if it does not fit
+        /// and truncates to N - 1 characters in release builds, counted in Truncations(). Producer side.
+        /// </summary>
+        /// <returns>False if the ring is full; nothing is queued.</returns>
+        bool TryPush(std::string_view sv)
+        {
+            assert(sv.size() < N && "FixedStringRing: input will be truncated");
+
+            return TryEmplace([sv](char* data, size_t capacity)
+            {
+                FixedStringDetail::CopyBytes(data, sv.data(), sv.size() < capacity ? sv.size() : capacity);
+                return sv.size();                               // The ring cuts and counts anything longer
+            });
+        }
+
+        /// <summary>
+        /// Queues a message written in place. write(char* data, size_t capacity) stores up to capacity
+        /// (N - 1) characters at data and returns how many it stored; the ring writes the terminator.
+        /// A return of more than capacity, as from snprintf, keeps the first capacity characters and
+        /// is counted in Truncations(). If write throws, the slot is published as aborted, so the
+        /// consumer skips it instead of waiting on it, and the exception propagates. Producer side.
+        /// </summary>
+        /// <example>ring.TryEmplace([&amp;](char* p, size_t cap) { return FormatLine(p, cap, event); });</example>
+        /// <returns>False if the ring is full; write is not called.</returns>
+        template<typename Writer>
+        bool TryEmplace(Writer&& write)
+        {
+            size_t pos;
+            Slot* slot = Claim(pos);
+
+            if (!slot) return false;
+
+            AbortGuard guard{ slot, pos };
+            size_t len = write(static_cast<char*>(slot->Text.Data), N - 1);
+            guard.Claimed = nullptr;
+
+            const bool truncated = len >= N;
+
+            if (truncated)
+            {
+                len = N - 1;
+                TruncatedMessages.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            slot->Length = len;
+            slot->Text.SetLength(len, truncated);
+            slot->Sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        /// <summary>
+        /// Removes the oldest message and passes it to visit(std::string_view). Consumer side.
+        /// The view is valid only during the call.
+        /// </summary>
+        /// <returns>False if the ring is empty.</returns>
+        template<typename Visitor>
+        bool TryConsume(Visitor&& visit) { return Drain(visit, 1) == 1; }
+
+        /// <summary>
+        /// Removes the oldest message into out. Consumer side.
+        /// </summary>
+        /// <returns>False if the ring is empty; out is unchanged.</returns>
+        template<size_t M, LengthPolicy LM>
+        bool TryPop(FixedString<M, LM>& out) { return TryConsume([&out](std::string_view sv) { out.Assign(sv); }); }
+
+        /// <summary>
+        /// Passes up to max ready messages, oldest first, to visit(std::string_view) and removes them.
+        /// Each slot is handed back to the producers as soon as its visit returns. Slots aborted by a
+        /// throwing writer are released without a visit and not counted. Consumer side.
+        /// </summary>
+        /// <returns>The number of messages visited.</returns>
+        template<typename Visitor>
+        size_t Drain(Visitor&& visit, size_t max = static_cast<size_t>(-1))
+        {
+            size_t count = 0;
+
+            while (count < max)
+            {
+                Slot& slot = Slots[Head & Mask];
+
+                if (slot.Sequence.load(std::memory_order_acquire) != Head + 1) break;
+
+                if (slot.Length != AbortedLength)
+                {
+                    visit(std::string_view(slot.Text.Data, slot.Length));
+                    ++count;
+                }
+
+                slot.Sequence.store(Head + Capacity, std::memory_order_release);
+                ++Head;
+            }
+
+            return count;
+        }
+
+        /// <summary>
+        /// Number of messages cut to N - 1 characters by TryPush or TryEmplace. Any thread.
+        /// </summary>
+        uint64_t Truncations() const { return TruncatedMessages.load(std::memory_order_relaxed); }
+
+        /// <summary>
+        /// The number of slots.
+        /// </summary>
+        static constexpr size_t Size() { return Capacity; }
+
+    private:
+        static constexpr size_t Mask = Capacity - 1;
+        static constexpr size_t CacheLine = 64;
+        static constexpr size_t AbortedLength = static_cast<size_t>(-1);      // Slot.Length of a slot whose writer threw
+
+        struct alignas(CacheLine) Slot
+        {
+            std::atomic<size_t> Sequence{ 0 };
+            size_t Length = 0;
+            FixedString<N> Text{ UninitializedTag{} };
+        };
+
+        /// <summary>
+        /// Publishes a claimed slot as aborted unless it is released first, so an exception from a
+        /// writer never leaves the consumer waiting on a slot that is never published.
+        /// </summary>
+        struct AbortGuard
+        {
+            Slot* Claimed;
+            size_t Pos;
+
+            ~AbortGuard()
+            {
+                if (!Claimed) return;
+
+                Claimed->Length = AbortedLength;
+                Claimed->Sequence.store(Pos + 1, std::memory_order_release);
+            }
+        };
+
+        /// <summary>
+        /// Reserves the next slot for writing, or returns null if the ring is full.
+        /// </summary>
+        Slot* Claim(size_t& pos)
+        {
+            pos = Tail.load(std::memory_order_relaxed);
+
+            for (;;)
+            {
+                Slot& slot = Slots[pos & Mask];
+                const size_t seq = slot.Sequence.load(std::memory_order_acquire);
+
+                if (seq != pos)
+                {
+                    if (static_cast<std::ptrdiff_t>(seq - pos) < 0) return nullptr;         // The consumer has not freed it yet
+                    pos = Tail.load(std::memory_order_relaxed);                              // Another producer took it
+                    continue;
+                }
+
+                if constexpr (P == RingProducers::Single)
+                {
+                    Tail.store(pos + 1, std::memory_order_relaxed);
+                    return &slot;
+                }
+                else
+                {
+                    if (Tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) return &slot;
+                }
+            }
+        }
+
+        alignas(CacheLine) std::atomic<size_t> Tail{ 0 };
+        std::atomic<uint64_t> TruncatedMessages{ 0 };           // Rarely written, so it shares the producers' line
+        alignas(CacheLine) size_t Head = 0;                     // Consumer position, touched only by the consumer
+        Slot Slots[Capacity];
+};
+
+
+
+#endif
@@ -0,0 +1,554 @@
+// ============================================================================
+// TextCPP - High Performance String Utility Library
+// ----------------------------------------------------------------------------
+// File:        fixed_string_simd.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+
+#ifndef __FIXED_STRING_SIMD_H_GUARD
+#define __FIXED_STRING_SIMD_H_GUARD
+
+#include <string_view>
+#include <cstring>
+#include <limits>
+
+#include "fixed_string_detail.h"
+
+
+// ISA selection happens at compile time from the target flags. Define FIXED_STRING_NO_SIMD to force
+// the portable 8-byte SWAR kernels.
+#if !defined(FIXED_STRING_NO_SIMD)
+    #if defined(__AVX2__)
+        #define FIXED_STRING_AVX2 1
+        #include <immintrin.h>
+    #elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define FIXED_STRING_SSE2 1
+        #include <emmintrin.h>
+    #elif defined(__ARM_NEON) || defined(_M_ARM64)
+        #define FIXED_STRING_NEON 1
+        #include <arm_neon.h>
+    #endif
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+
+namespace FixedStringDetail
+{
+    /// <summary>
+    /// Index of the lowest set bit. mask must be non-zero.
+    /// </summary>
+    inline unsigned LowestBit(uint64_t mask)
+    {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward64(&index, mask);
+        return static_cast<unsigned>(index);
+#else
+        return static_cast<unsigned>(__builtin_ctzll(mask));
+#endif
+    }
+
+    /// <summary>
+    /// Index of the highest set bit. mask must be non-zero.
+    /// </summary>
+    inline unsigned HighestBit(uint64_t mask)
+    {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanReverse64(&index, mask);
+        return static_cast<unsigned>(index);
+#else
+        return 63u - static_cast<unsigned>(__builtin_clzll(mask));
+#endif
+    }
+
+    /// <summary>
+    /// Number of set bits.
+    /// </summary>
+    inline unsigned PopCount64(uint64_t x)
+    {
+#if defined(_MSC_VER) && defined(_M_X64)
+        return static_cast<unsigned>(__popcnt64(x));
+#elif defined(_MSC_VER)
+        x = x - ((x >> 1) & 0x5555555555555555ull);
+        x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+        return static_cast<unsigned>((((x + (x >> 4)) & 0x0F0F0F0F0F0F0F0Full) * 0x0101010101010101ull) >> 56);
+#else
+        return static_cast<unsigned>(__builtin_popcountll(x));
+#endif
+    }
+
+    /// <summary>
+    /// A mask of the low count bits. count may be 64 or more.
+    /// </summary>
+    inline uint64_t LowBits(size_t count) { return count >= 64 ? ~0ull : ((1ull << count) - 1); }
+
+    /// <summary>
+    /// Broadcasts a byte into every byte of a word.
+    /// </summary>
+    constexpr uint64_t Broadcast64(char c) { return 0x0101010101010101ull * static_cast<unsigned char>(c); }
+
+    /// <summary>
+    /// Bit 7 of each byte of the result is set exactly where the byte of x is zero.
+    /// </summary>
+    constexpr uint64_t ZeroBytes64(uint64_t x)
+    {
+        const uint64_t low7 = 0x7F7F7F7F7F7F7F7Full;
+        return ~(((x & low7) + low7) | x | low7);
+    }
+
+    /// <summary>
+    /// Loads a word with the first byte in the least significant position on every target.
+    /// </summary>
+    inline uint64_t LoadLittle64(const char* p) { uint64_t v = Load64(p); return IsLittleEndian ? v : ByteSwap64(v); }
+
+
+#if defined(FIXED_STRING_AVX2)
+    constexpr size_t SimdWidth = 32;            // Bytes per block
+    constexpr unsigned SimdMaskBits = 1;        // Mask bits per byte
+    constexpr uint64_t SimdFullMask = 0xFFFFFFFFull;
+
+    inline uint64_t SimdMatch(const char* p, char c)
+    {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, _mm256_set1_epi8(c))));
+    }
+
+    inline uint64_t SimdHighBytes(const char* p)
+    {
+        return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p))));
+    }
+#elif defined(FIXED_STRING_SSE2)
+    constexpr size_t SimdWidth = 16;
+    constexpr unsigned SimdMaskBits = 1;
+    constexpr uint64_t SimdFullMask = 0xFFFFull;
+
+    inline uint64_t SimdMatch(const char* p, char c)
+    {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, _mm_set1_epi8(c))));
+    }
+
+    inline uint64_t SimdHighBytes(const char* p)
+    {
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))));
+    }
+#elif defined(FIXED_STRING_NEON)
+    constexpr size_t SimdWidth = 16;
+    constexpr unsigned SimdMaskBits = 4;        // Narrowing shift leaves a nibble per byte
+    constexpr uint64_t SimdFullMask = ~0ull;
+
+    inline uint64_t SimdMatch(const char* p, char c)
+    {
+        uint8x16_t eq = vceqq_u8(vld1q_u8(reinterpret_cast<const uint8_t*>(p)), vdupq_n_u8(static_cast<uint8_t>(c)));
+        uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(eq), 4);
+        return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+    }
+
+    inline uint64_t SimdHighBytes(const char* p)
+    {
+        uint8x16_t high = vcgeq_u8(vld1q_u8(reinterpret_cast<const uint8_t*>(p)), vdupq_n_u8(0x80));
+        uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(high), 4);
+        return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+    }
+#else
+    constexpr size_t SimdWidth = 8;
+    constexpr unsigned SimdMaskBits = 8;        // Bit 7 of each byte
+    constexpr uint64_t SimdFullMask = 0x8080808080808080ull;
+
+    inline uint64_t SimdMatch(const char* p, char c) { return ZeroBytes64(LoadLittle64(p) ^ Broadcast64(c)); }
+
+    inline uint64_t SimdHighBytes(const char* p) { return LoadLittle64(p) & SimdFullMask; }
+#endif
+
+    /// <summary>
+    /// Inverts a block match mask, so it marks the bytes that did not match.
+    /// </summary>
+    inline uint64_t InvertMask(uint64_t mask) { return ~mask & SimdFullMask; }
+
+    /// <summary>
+    /// Keeps only the mask bits for bytes [from, to) of a block.
+    /// </summary>
+    inline uint64_t ClipMask(uint64_t mask, size_t from, size_t to) { return mask & LowBits(to * SimdMaskBits) & ~LowBits(from * SimdMaskBits); }
+
+    /// <summary>
+    /// Finds the first occurrence of c in p[0, len).
+    /// The first two blocks may be loaded anywhere in p[0, readable), which lets FixedString scan a short
+    /// string straight from its buffer without tail handling; plain views pass readable == len. Longer
+    /// ranges continue in memchr, which the C library dispatches to its widest vector unit.
+    /// </summary>
+    /// <returns>The index, or npos.</returns>
+    inline size_t FindChar(const char* p, size_t len, char c, size_t readable)
+    {
+        if (len > 2 * SimdWidth)
+        {
+            const void* hit = std::memchr(p, c, len);
+            return hit ? static_cast<size_t>(static_cast<const char*>(hit) - p) : std::string_view::npos;
+        }
+
+        size_t i = 0;
+
+        for (; i + SimdWidth <= readable && i < len; i += SimdWidth)
+        {
+            const uint64_t mask = ClipMask(SimdMatch(p + i, c), 0, len - i);
+            if (mask) return i + LowestBit(mask) / SimdMaskBits;
+        }
+
+        if (i < len && readable >= SimdWidth)                          // Overlapping final block
+        {
+            const size_t base = readable - SimdWidth;
+            const uint64_t mask = ClipMask(SimdMatch(p + base, c), i - base, len - base);
+            return mask ? base + LowestBit(mask) / SimdMaskBits : std::string_view::npos;
+        }
+
+        for (; i < len; ++i)
+        {
+            if (p[i] == c) return i;
+        }
+
+        return std::string_view::npos;
+    }
+
+    /// <summary>
+    /// Finds the last occurrence of c in p[0, len), scanning blocks from the end.
+    /// </summary>
+    /// <returns>The index, or npos.</returns>
+    inline size_t RFindChar(const char* p, size_t len, char c)
+    {
+        size_t end = len;
+
+        for (; end >= SimdWidth; end -= SimdWidth)
+        {
+            const uint64_t mask = SimdMatch(p + end - SimdWidth, c);
+            if (mask) return end - SimdWidth + HighestBit(mask) / SimdMaskBits;
+        }
+
+        while (end > 0)
+        {
+            if (p[--end] == c) return end;
+        }
+
+        return std::string_view::npos;
+    }
+
+    /// <summary>
+    /// Finds the first occurrence of needle in p[0, len). Candidates are found a block at a time by
+    /// matching the first and last needle bytes at once, then confirmed with BytesEqual.
+    /// </summary>
+    /// <returns>The index, or npos.</returns>
+    inline size_t FindString(const char* p, size_t len, const char* needle, size_t needleLen, size_t readable)
+    {
+        if (needleLen == 0) return 0;
+        if (needleLen > len) return std::string_view::npos;
+        if (needleLen == 1) return FindChar(p, len, needle[0], readable);
+
+        const size_t last = needleLen - 1;
+        const size_t starts = len - last;                               // Candidate start positions [0, starts)
+        size_t i = 0;
+
+        for (; i < starts && i + last + SimdWidth <= readable; i += SimdWidth)
+        {
+            uint64_t mask = SimdMatch(p + i, needle[0]) & SimdMatch(p + i + last, needle[last]);
+            mask = ClipMask(mask, 0, starts - i);
+
+            while (mask)
+            {
+                const size_t at = i + LowestBit(mask) / SimdMaskBits;
+                if (BytesEqual(p + at + 1, needle + 1, needleLen - 2)) return at;
+                mask &= ~LowBits((at - i + 1) * SimdMaskBits);
+            }
+        }
+
+        for (; i < starts; ++i)
+        {
+            if (p[i] == needle[0] && p[i + last] == needle[last] && BytesEqual(p + i + 1, needle + 1, needleLen - 2)) return i;
+        }
+
+        return std::string_view::npos;
+    }
+
+    /// <summary>
+    /// A 256-entry byte membership table for FindFirstOf / FindFirstNotOf.
+    /// </summary>
+    struct ByteSet
+    {
+        uint64_t Bits[4] = {};
+
+        explicit ByteSet(std::string_view set)
+        {
+            for (char c : set)
+            {
+                const unsigned char b = static_cast<unsigned char>(c);
+                Bits[b >> 6] |= 1ull << (b & 63);
+            }
+        }
+
+        bool Contains(char c) const
+        {
+            const unsigned char b = static_cast<unsigned char>(c);
+            return (Bits[b >> 6] >> (b & 63)) & 1;
+        }
+    };
+
+    /// <summary>
+    /// Finds the first byte of p[0, len) that is in set. Sets of up to four bytes are matched a block
+    /// at a time; larger sets use a membership table.
+    /// </summary>
+    /// <returns>The index, or npos.</returns>
+    inline size_t FindFirstOf(const char* p, size_t len, std::string_view set, size_t readable)
+    {
+        if (set.empty()) return std::string_view::npos;
+        if (set.size() == 1) return FindChar(p, len, set[0], readable);
+
+        size_t i = 0;
+
+        if (set.size() <= 4)
+        {
+            const char a = set[0], b = set[1];
+            const char c = set.size() > 2 ? set[2] : b;
+            const char d = set.size() > 3 ? set[3] : c;
+
+            for (; i + SimdWidth <= readable && i < len; i += SimdWidth)
+            {
+                uint64_t mask = SimdMatch(p + i, a) | SimdMatch(p + i, b) | SimdMatch(p + i, c) | SimdMatch(p + i, d);
+                mask = ClipMask(mask, 0, len - i);
+                if (mask) return i + LowestBit(mask) / SimdMaskBits;
+            }
+        }
+
+        const ByteSet table(set);
+
+        for (; i < len; ++i)
+        {
+            if (table.Contains(p[i])) return i;
+        }
+
+        return std::string_view::npos;
+    }
+
+    /// <summary>
+    /// Finds the first byte of p[0, len) that is not in set. A single-byte set is matched a block at a time.
+    /// </summary>
+    /// <returns>The index, or npos.</returns>
+    inline size_t FindFirstNotOf(const char* p, size_t len, std::string_view set, size_t readable)
+    {
+        if (set.empty()) return len > 0 ? 0 : std::string_view::npos;
+
+        size_t i = 0;
+
+        if (set.size() == 1)
+        {
+            for (; i + SimdWidth <= readable && i < len; i += SimdWidth)
+            {
+                const uint64_t mask = ClipMask(InvertMask(SimdMatch(p + i, set[0])), 0, len - i);
+                if (mask) return i + LowestBit(mask) / SimdMaskBits;
+            }
+        }
+
+        const ByteSet table(set);
+
+        for (; i < len; ++i)
+        {
+            if (!table.Contains(p[i])) return i;
+        }
+
+        return std::string_view::npos;
+    }
+
+    /// <summary>
+    /// Maps ASCII letters in one 8-byte word to lower case (Upper == false) or upper case. Other bytes,
+    /// including non-ASCII bytes, are unchanged.
+    /// </summary>
+    template<bool Upper>
+    constexpr uint64_t CaseMapWord(uint64_t x)
+    {
+        const uint64_t high = 0x8080808080808080ull;
+        const uint64_t first = Broadcast64(Upper ? 'a' : 'A');
+        const uint64_t last = Broadcast64(Upper ? 'z' : 'Z');
+
+        const uint64_t low7 = x & 0x7F7F7F7F7F7F7F7Full;
+        const uint64_t geFirst = low7 + (high - first);                 // Bit 7 set where byte >= first
+        const uint64_t gtLast = low7 + (Broadcast64(0x7F) - last);      // Bit 7 set where byte > last
+        const uint64_t inRange = (geFirst ^ gtLast) & ~x & high;        // ASCII bytes in [first, last]
+
+        return Upper ? x & ~(inRange >> 2) : x | (inRange >> 2);        // 0x80 >> 2 is the 0x20 case bit
+    }
+
+    /// <summary>
+    /// Maps ASCII letters in p[0, len) to lower case (Upper == false) or upper case, a block at a time.
+    /// The final partial block is handled by remapping an overlapping block, which is idempotent,
+    /// so no byte outside [0, len) is read or written.
+    /// </summary>
+    template<bool Upper>
+    inline void CaseMapAscii(char* p, size_t len)
+    {
+#if defined(FIXED_STRING_AVX2) || defined(FIXED_STRING_SSE2) || defined(FIXED_STRING_NEON)
+        auto mapBlock = [](char* at)
+        {
+#if defined(FIXED_STRING_AVX2)
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(at));
+            __m256i shifted = _mm256_add_epi8(v, _mm256_set1_epi8(static_cast<char>(128 - (Upper ? 'a' : 'A'))));
+            __m256i inRange = _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(-128 + 26)), shifted);
+            __m256i bit = _mm256_and_si256(inRange, _mm256_set1_epi8(0x20));
+            v = Upper ? _mm256_andnot_si256(bit, v) : _mm256_or_si256(v, bit);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(at), v);
+#elif defined(FIXED_STRING_SSE2)
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(at));
+            __m128i shifted = _mm_add_epi8(v, _mm_set1_epi8(static_cast<char>(128 - (Upper ? 'a' : 'A'))));
+            __m128i inRange = _mm_cmplt_epi8(shifted, _mm_set1_epi8(static_cast<char>(-128 + 26)));
+            __m128i bit = _mm_and_si128(inRange, _mm_set1_epi8(0x20));
+            v = Upper ? _mm_andnot_si128(bit, v) : _mm_or_si128(v, bit);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(at), v);
+#else
+            uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(at));
+            uint8x16_t offset = vsubq_u8(v, vdupq_n_u8(static_cast<uint8_t>(Upper ? 'a' : 'A')));
+            uint8x16_t bit = vandq_u8(vcltq_u8(offset, vdupq_n_u8(26)), vdupq_n_u8(0x20));
+            v = Upper ? vbicq_u8(v, bit) : vorrq_u8(v, bit);
+            vst1q_u8(reinterpret_cast<uint8_t*>(at), v);
+#endif
+        };
+
+        if (len >= SimdWidth)
+        {
+            size_t i = 0;
+            for (; i + SimdWidth <= len; i += SimdWidth) mapBlock(p + i);
+            if (i < len) mapBlock(p + len - SimdWidth);
+            return;
+        }
+#endif
+        size_t i = 0;
+
+        for (; i + 8 <= len; i += 8)
+        {
+            uint64_t word = CaseMapWord<Upper>(LoadLittle64(p + i));
+            if (!IsLittleEndian) word = ByteSwap64(word);
+            std::memcpy(p + i, &word, 8);
+        }
+
+        for (; i < len; ++i)
+        {
+            const char c = p[i];
+
+            if (Upper ? (c >= 'a' && c <= 'z') : (c >= 'A' && c <= 'Z')) {
+                p[i] = static_cast<char>(c ^ 0x20);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Replaces every occurrence of from with to in p[0, len), a block at a time.
+    /// </summary>
+    inline void ReplaceChar(char* p, size_t len, char from, char to)
+    {
+        size_t i = 0;
+
+#if defined(FIXED_STRING_AVX2)
+        for (; i + 32 <= len; i += 32)
+        {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+            __m256i eq = _mm256_cmpeq_epi8(v, _mm256_set1_epi8(from));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(p + i), _mm256_blendv_epi8(v, _mm256_set1_epi8(to), eq));
+        }
+#elif defined(FIXED_STRING_SSE2)
+        for (; i + 16 <= len; i += 16)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+            __m128i eq = _mm_cmpeq_epi8(v, _mm_set1_epi8(from));
+            v = _mm_or_si128(_mm_andnot_si128(eq, v), _mm_and_si128(eq, _mm_set1_epi8(to)));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(p + i), v);
+        }
+#elif defined(FIXED_STRING_NEON)
+        for (; i + 16 <= len; i += 16)
+        {
+            uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(p + i));
+            uint8x16_t eq = vceqq_u8(v, vdupq_n_u8(static_cast<uint8_t>(from)));
+            vst1q_u8(reinterpret_cast<uint8_t*>(p + i), vbslq_u8(eq, vdupq_n_u8(static_cast<uint8_t>(to)), v));
+        }
+#endif
+
+        for (; i < len; ++i)
+        {
+            if (p[i] == from) p[i] = to;
+        }
+    }
+
+    /// <summary>
+    /// Converts up to eight ASCII decimal digits to their value with three multiplies.
+    /// Returns false if any byte is not a digit.
+    /// </summary>
+    inline bool ParseDigits8(const char* p, size_t len, uint64_t& value)
+    {
+        char block[8];                                          // Right-aligned behind leading '0's
+        std::memset(block, '0', 8);
+        std::memcpy(block + 8 - len, p, len);
+
+        uint64_t v = LoadLittle64(block);
+
+        if (((v & 0xF0F0F0F0F0F0F0F0ull) | (((v + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4)) != 0x3333333333333333ull) {
+            return false;
+        }
+
+        v -= 0x3030303030303030ull;
+        v = (v * 10 + (v >> 8)) & 0x00FF00FF00FF00FFull;       // Pairs of digits
+        v = (v * 100 + (v >> 16)) & 0x0000FFFF0000FFFFull;      // Groups of four
+        v = (v * 10000 + (v >> 32)) & 0x00000000FFFFFFFFull;    // All eight
+
+        value = v;
+        return true;
+    }
+
+    /// <summary>
+    /// SWAR parse of a decimal integer field of 1 to 16 digits, with a leading '-' for signed T.
+    /// Returns false, leaving value unchanged, for anything else (other lengths, other characters,
+    /// out of range for T) so the caller can fall back to std::from_chars and get its exact result.
+    /// </summary>
+    template<typename T>
+    inline bool ParseDecimalSwar(const char* p, size_t len, T& value)
+    {
+        bool negative = false;
+
+        if constexpr (std::is_signed_v<T>)
+        {
+            if (len > 0 && *p == '-') { negative = true; ++p; --len; }
+        }
+
+        if (len == 0 || len > 16) return false;
+
+        uint64_t digits = 0;
+
+        if (len > 8)
+        {
+            uint64_t high = 0;
+            if (!ParseDigits8(p, len - 8, high) || !ParseDigits8(p + len - 8, 8, digits)) return false;
+            digits += high * 100000000ull;
+        }
+        else if (!ParseDigits8(p, len, digits)) {
+            return false;
+        }
+
+        using U = std::make_unsigned_t<T>;
+        const uint64_t limit = static_cast<uint64_t>(std::numeric_limits<T>::max()) + (negative ? 1 : 0);
+
+        if (digits > limit) return false;
+
+        value = static_cast<T>(negative ? static_cast<U>(0 - static_cast<U>(digits)) : static_cast<U>(digits));
+        return true;
+    }
+}
+
+
+
+#endif
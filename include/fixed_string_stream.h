@@ -0,0 +1,53 @@
+// ============================================================================
+// TextCPP - High Performance String Utility Library
+// ----------------------------------------------------------------------------
+// File:        fixed_string_stream.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+
+#ifndef __FIXED_STRING_STREAM_H_GUARD
+#define __FIXED_STRING_STREAM_H_GUARD
+
+#include <ostream>
+
+#include "fixed_string.h"
+
+
+/// <summary>
+/// Stream output operator. Writes the string contents to the output stream, honoring width and fill.
+/// Kept out of fixed_string.h so that translation units which never use iostreams do not include them;
+/// fixed_string_writer.h is the stream-free output path.
+/// </summary>
+/// <param name="os">The output stream.</param>
+/// <param name="fs">The FixedString to write.</param>
+/// <returns>Reference to the output stream.</returns>
+template<size_t N, LengthPolicy L>
+std::ostream& operator<<(std::ostream& os, const FixedString<N, L>& fs) { return os << std::string_view(fs); }
+
+template<size_t N, LengthPolicy L> class HashedFixedString;
+template<size_t N, LengthPolicy L> class Utf8FixedString;
+
+/// <summary>
+/// Stream output operators for the FixedString wrappers. Declared here rather than as friends of the
+/// wrappers, so that without this header the wrappers have no operator&lt;&lt; at all instead of
+/// streaming through their implicit conversions.
+/// </summary>
+template<size_t N, LengthPolicy L>
+std::ostream& operator<<(std::ostream& os, const HashedFixedString<N, L>& hs) { return os << std::string_view(hs); }
+
+template<size_t N, LengthPolicy L>
+std::ostream& operator<<(std::ostream& os, const Utf8FixedString<N, L>& us) { return os << std::string_view(us); }
+
+
+
+#endif
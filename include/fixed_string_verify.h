@@ -0,0 +1,50 @@
+// ============================================================================
+// TextCPP - High Performance String Utility Library
+// ----------------------------------------------------------------------------
+// File:        fixed_string_verify.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+
+#ifndef __FIXED_STRING_VERIFY_H_GUARD
+#define __FIXED_STRING_VERIFY_H_GUARD
+
+#include "fixed_string_config.h"
+
+#if FIXED_STRING_VERIFY_FAST_PATHS
+#include <cstdio>
+#include <cstdlib>
+
+
+namespace FixedStringDetail
+{
+    /// <summary>
+    /// Aborts, naming the operation, if a fast path disagreed with its reference.
+    /// </summary>
+    inline void VerifyFastPath(bool agrees, const char* operation)
+    {
+        if (agrees) return;
+
+        std::fprintf(stderr, "FixedString: fast path of %s disagrees with std::string_view\n", operation);
+        std::abort();
+    }
+
+    /// <summary>
+    /// True if two three-way comparison results order the same way.
+    /// </summary>
+    constexpr bool SameOrder(int a, int b) { return (a < 0) == (b < 0) && (a > 0) == (b > 0); }
+}
+#endif
+
+
+
+#endif
@@ -0,0 +1,334 @@
+// ============================================================================
+// TextCPP - High Performance String Utility Library
+// ----------------------------------------------------------------------------
+// File:        fixed_string_writer.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+
+#ifndef __FIXED_STRING_WRITER_H_GUARD
+#define __FIXED_STRING_WRITER_H_GUARD
+
+#include <cstdio>
+#include <vector>
+
+#include "fixed_string.h"
+
+#if !defined(_WIN32) && __has_include(<sys/uio.h>)
+#include <sys/uio.h>
+#include <unistd.h>
+#include <climits>
+#include <cerrno>
+#define FIXED_STRING_HAS_WRITEV 1
+#else
+#define FIXED_STRING_HAS_WRITEV 0
+#endif
+
+
+/// <summary>
+/// A span of bytes to write: the library's equivalent of struct iovec.
+/// </summary>
+struct TextPiece
+{
+    const char* Data;
+    size_t Length;
+};
+
+
+/// <summary>
+/// Destination for FixedStringWriter. A sink receives pieces in batches and writes all of them, in order,
+/// or reports failure. Derive from it to send output anywhere else.
+/// </summary>
+class TextSink
+{
+    public:
+        virtual ~TextSink() = default;
+
+        /// <summary>
+        /// Writes every byte of pieces[0, count) in order.
+        /// </summary>
+        /// <returns>False if the output failed; the sink may have written part of the batch.</returns>
+        virtual bool Write(const TextPiece* pieces, size_t count) = 0;
+};
+
+
+/// <summary>
+/// Writes to a C stdio stream with one fwrite per piece. The stream is not closed.
+/// </summary>
+class FileSink : public TextSink
+{
+    public:
+        explicit FileSink(std::FILE* file) : File(file) {}
+
+        bool Write(const TextPiece* pieces, size_t count) override
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (pieces[i].Length > 0 && std::fwrite(pieces[i].Data, 1, pieces[i].Length, File) != pieces[i].Length) return false;
+            }
+
+            return true;
+        }
+
+    private:
+        std::FILE* File;
+};
+
+
+#if FIXED_STRING_HAS_WRITEV
+/// <summary>
+/// Writes to a POSIX file descriptor, a whole batch per writev call, retrying after partial writes and
+/// EINTR. The descriptor is not closed.
+/// </summary>
+class FdSink : public TextSink
+{
+    public:
+        explicit FdSink(int fd) : Fd(fd) {}
+
+        bool Write(const TextPiece* pieces, size_t count) override
+        {
+            iovec vectors[BatchLimit];
+
+            while (count > 0)
+            {
+                const size_t batch = count < BatchLimit ? count : BatchLimit;
+
+                for (size_t i = 0; i < batch; ++i) {
+                    vectors[i].iov_base = const_cast<char*>(pieces[i].Data);
+                    vectors[i].iov_len = pieces[i].Length;
+                }
+
+                if (!WriteVectors(vectors, batch)) return false;
+
+                pieces += batch;
+                count -= batch;
+            }
+
+            return true;
+        }
+
+    private:
+#if defined(IOV_MAX) && IOV_MAX < 256
+        static constexpr size_t BatchLimit = IOV_MAX;
+#else
+        static constexpr size_t BatchLimit = 256;
+#endif
+
+        bool WriteVectors(iovec* vectors, size_t count)
+        {
+            while (count > 0)
+            {
+                const ssize_t written = ::writev(Fd, vectors, static_cast<int>(count));
+
+                if (written < 0)
+                {
+                    if (errno == EINTR) continue;
+                    return false;
+                }
+
+                size_t left = static_cast<size_t>(written);
+
+                while (count > 0 && left >= vectors->iov_len)         // Skip the pieces that went out whole
+                {
+                    left -= vectors->iov_len;
+                    ++vectors;
+                    --count;
+                }
+
+                if (count > 0)
+                {
+                    vectors->iov_base = static_cast<char*>(vectors->iov_base) + left;
+                    vectors->iov_len -= left;
+                }
+            }
+
+            return true;
+        }
+
+        int Fd;
+};
+#endif
+
+
+/// <summary>
+/// Buffered text output without iostreams. Small pieces are copied into one buffer that goes to the sink
+/// when it fills; a piece too large to be worth copying goes to the sink together with the buffer in a
+/// single batch, and WriteLines hands whole arrays of FixedStrings to the sink without copying them.
+/// Lengths come from the strings themselves, so nothing is rescanned.
+/// </summary>
+/// <example>
+/// FdSink out(STDOUT_FILENO);
+/// FixedStringWriter writer(out);
+/// writer &lt;&lt; "user=" &lt;&lt; name &lt;&lt; " id=" &lt;&lt; id &lt;&lt; '\n';
+/// </example>
+/// <remarks>
+/// The destructor flushes. After a sink failure, Failed() is true and further output is dropped.
+/// Not thread-safe.
+/// </remarks>
+class FixedStringWriter
+{
+    public:
+        /// <summary>
+        /// Writes to sink, which must outlive the writer, through a buffer of bufferSize bytes.
+        /// </summary>
+        explicit FixedStringWriter(TextSink& sink, size_t bufferSize = 64 * 1024) : Sink(sink), Buffer(bufferSize > 0 ? bufferSize : 1) {}
+
+        FixedStringWriter(const FixedStringWriter&) = delete;
+        FixedStringWriter& operator=(const FixedStringWriter&) = delete;
+
+        ~FixedStringWriter() { Flush(); }
+
+        /// <summary>
+        /// Writes a string view.
+        /// </summary>
+        FixedStringWriter& Write(std::string_view sv)
+        {
+            if (sv.size() <= Buffer.size() - Used)
+            {
+                FixedStringDetail::CopyBytes(Buffer.data() + Used, sv.data(), sv.size());
+                Used += sv.size();
+                return *this;
+            }
+
+            if (sv.size() < Buffer.size() / 2)                  // Small: start a new buffer with it
+            {
+                Flush();
+                FixedStringDetail::CopyBytes(Buffer.data(), sv.data(), sv.size());
+                Used = sv.size();
+                return *this;
+            }
+
+            const TextPiece pieces[] = { { Buffer.data(), Used }, { sv.data(), sv.size() } };     // Large: one batch, no copy
+            Send(pieces, 2);
+            Used = 0;
+            return *this;
+        }
+
+        /// <summary>
+        /// Writes a null-terminated C string. Null pointer is treated as empty string.
+        /// </summary>
+        FixedStringWriter& Write(const char* str) { return Write(str ? std::string_view(str) : std::string_view()); }
+
+        /// <summary>
+        /// Writes a std::string without rescanning it.
+        /// </summary>
+        FixedStringWriter& Write(const std::string& str) { return Write(std::string_view(str)); }
+
+        /// <summary>
+        /// Writes a FixedString of any capacity or policy.
+        /// </summary>
+        template<size_t N, LengthPolicy L>
+        FixedStringWriter& Write(const FixedString<N, L>& str) { return Write(static_cast<std::string_view>(str)); }
+
+        /// <summary>
+        /// Writes a single character.
+        /// </summary>
+        FixedStringWriter& Write(char c)
+        {
+            if (Used == Buffer.size()) Flush();
+
+            Buffer[Used++] = c;
+            return *this;
+        }
+
+        /// <summary>
+        /// Writes an integer or floating-point value in the shortest form of FixedString::AssignNumber.
+        /// </summary>
+        template<typename T, std::enable_if_t<(std::is_integral_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char>) || std::is_floating_point_v<T>, int> = 0>
+        FixedStringWriter& Write(T value)
+        {
+            FixedString<32> text(UninitializedTag{});
+            text.AssignNumber(value);
+            return Write(static_cast<std::string_view>(text));
+        }
+
+        /// <summary>
+        /// Writes a piece. Equivalent to Write, for stream-style chains.
+        /// </summary>
+        template<typename T>
+        FixedStringWriter& operator<<(const T& piece) { return Write(piece); }
+
+        /// <summary>
+        /// Writes count FixedStrings, each followed by separator, handing them to the sink in batches
+        /// of (string, separator) pieces instead of copying them: with FdSink, one writev per batch.
+        /// </summary>
+        template<size_t N, LengthPolicy L>
+        FixedStringWriter& WriteLines(const FixedString<N, L>* items, size_t count, char separator = '\n')
+        {
+            TextPiece pieces[LineBatch * 2 + 1];
+
+            SeparatorByte = separator;                          // The pieces point at it
+            size_t i = 0;
+
+            while (i < count)
+            {
+                size_t used = 0;
+
+                if (Used > 0) pieces[used++] = { Buffer.data(), Used };
+
+                for (; i < count && used + 2 <= LineBatch * 2 + 1; ++i)
+                {
+                    pieces[used++] = { items[i].Data, items[i].length() };
+                    pieces[used++] = { &SeparatorByte, 1 };
+                }
+
+                Send(pieces, used);
+                Used = 0;
+            }
+
+            return *this;
+        }
+
+        /// <summary>
+        /// Sends everything buffered to the sink.
+        /// </summary>
+        /// <returns>False if this or an earlier write failed.</returns>
+        bool Flush()
+        {
+            if (Used > 0)
+            {
+                const TextPiece piece = { Buffer.data(), Used };
+                Send(&piece, 1);
+                Used = 0;
+            }
+
+            return !Broken;
+        }
+
+        /// <summary>
+        /// True once the sink has failed.
+        /// </summary>
+        bool Failed() const { return Broken; }
+
+        /// <summary>
+        /// Bytes waiting in the buffer.
+        /// </summary>
+        size_t Pending() const { return Used; }
+
+    private:
+        static constexpr size_t LineBatch = 128;
+
+        void Send(const TextPiece* pieces, size_t count)
+        {
+            if (!Broken && !Sink.Write(pieces, count)) Broken = true;
+        }
+
+        TextSink& Sink;
+        std::vector<char> Buffer;
+        size_t Used = 0;
+        bool Broken = false;
+        char SeparatorByte = '\n';
+};
+
+
+
+#endif
@@ -0,0 +1,175 @@
+// ============================================================================
+// TextCPP - High Performance String Utility Library
+// ----------------------------------------------------------------------------
+// File:        hashed_fixed_string.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+
+#ifndef __HASHED_FIXED_STRING_H_GUARD
+#define __HASHED_FIXED_STRING_H_GUARD
+
+#include "fixed_string.h"
+
+
+/// <summary>
+/// A FixedString paired with its precomputed hash. The hash is computed once on every assignment
+/// and returned by std::hash, so rehashing containers and repeated probes never hash the key again.
+/// Equality rejects on the cached hash before comparing contents.
+/// The contents are read-only except through assignment, which keeps the cached hash in sync.
+/// </summary>
+/// <typeparam name="N">The total buffer size in bytes, including the null terminator.</typeparam>
+/// <typeparam name="L">How the length is tracked. See LengthPolicy.</typeparam>
+template<size_t N, LengthPolicy L = LengthPolicy::Scan>
+class HashedFixedString
+{
+    public:
+        /// <summary>
+        /// Default constructor. Holds an empty string and its hash.
+        /// </summary>
+        HashedFixedString() : HashValue(Value.Hash()) {}
+
+        /// <summary>
+        /// Constructs from a null-terminated C string. Null pointer is treated as empty string.
+        /// </summary>
+        /// <param name="str">The source C string. May be null.</param>
+        HashedFixedString(const char* str) : Value(str), HashValue(Value.Hash()) {}
+
+        /// <summary>
+        /// Constructs from a std::string.
+        /// </summary>
+        /// <param name="str">The source string.</param>
+        HashedFixedString(const std::string& str) : Value(str), HashValue(Value.Hash()) {}
+
+        /// <summary>
+        /// Constructs from a std::string_view.
+        /// </summary>
+        /// <param name="sv">The source string view.</param>
+        HashedFixedString(std::string_view sv) : Value(sv), HashValue(Value.Hash()) {}
+
+        /// <summary>
+        /// Constructs from a FixedString of the same capacity and policy.
+        /// </summary>
+        /// <param name="str">The source FixedString.</param>
+        HashedFixedString(const FixedString<N, L>& str) : Value(str), HashValue(Value.Hash()) {}
+
+        /// <summary>
+        /// Assigns from a null-terminated C string and recomputes the hash.
+        /// </summary>
+        HashedFixedString& operator=(const char* str) { Value = str; HashValue = Value.Hash(); return *this; }
+
+        /// <summary>
+        /// Assigns from a std::string and recomputes the hash.
+        /// </summary>
+        HashedFixedString& operator=(const std::string& str) { Value = str; HashValue = Value.Hash(); return *this; }
+
+        /// <summary>
+        /// Assigns from a std::string_view and recomputes the hash.
+        /// </summary>
+        HashedFixedString& operator=(std::string_view sv) { Value = sv; HashValue = Value.Hash(); return *this; }
+
+        /// <summary>
+        /// Assigns from a FixedString of the same capacity and policy and recomputes the hash.
+        /// </summary>
+        HashedFixedString& operator=(const FixedString<N, L>& str) { Value = str; HashValue = Value.Hash(); return *this; }
+
+        /// <summary>
+        /// Returns the cached hash. Equal to String().Hash().
+        /// </summary>
+        uint64_t Hash() const { return HashValue; }
+
+        /// <summary>
+        /// Returns the underlying FixedString.
+        /// </summary>
+        const FixedString<N, L>& String() const { return Value; }
+
+        /// <summary>
+        /// Returns a null-terminated pointer to the internal buffer.
+        /// </summary>
+        const char* c_str() const { return Value.c_str(); }
+
+        /// <summary>
+        /// Returns the length of the string. See FixedString::length.
+        /// </summary>
+        size_t length() const { return Value.length(); }
+
+        /// <summary>
+        /// Returns true if the string is empty.
+        /// </summary>
+        bool empty() const { return Value.empty(); }
+
+        /// <summary>
+        /// Implicit conversion to the underlying FixedString.
+        /// </summary>
+        operator const FixedString<N, L>& () const { return Value; }
+
+        /// <summary>
+        /// Implicit conversion to std::string_view. Does not allocate.
+        /// </summary>
+        operator std::string_view() const { return Value; }
+
+        /// <summary>
+        /// Equality comparison. Compares the cached hashes first, then the contents.
+        /// </summary>
+        bool operator==(const HashedFixedString& other) const { return HashValue == other.HashValue && Value == other.Value; }
+
+        /// <summary>
+        /// Inequality comparison. Compares the cached hashes first, then the contents.
+        /// </summary>
+        bool operator!=(const HashedFixedString& other) const { return !(*this == other); }
+
+        /// <summary>
+        /// Equality comparison against a std::string_view.
+        /// </summary>
+        bool operator==(std::string_view other) const { return Value == other; }
+
+        /// <summary>
+        /// Inequality comparison against a std::string_view.
+        /// </summary>
+        bool operator!=(std::string_view other) const { return Value != other; }
+
+        /// <summary>
+        /// Equality comparison against a null-terminated C string. A null pointer is never considered equal.
+        /// </summary>
+        bool operator==(const char* other) const { return Value == other; }
+
+        /// <summary>
+        /// Inequality comparison against a null-terminated C string.
+        /// </summary>
+        bool operator!=(const char* other) const { return Value != other; }
+
+        /// <summary>
+        /// Lexicographic ordering by contents, for ordered containers.
+        /// </summary>
+        bool operator<(const HashedFixedString& other) const { return Value < other.Value; }
+
+    private:
+        FixedString<N, L> Value;
+        uint64_t HashValue;
+};
+
+
+/// <summary>
+/// std::hash specialization returning the cached hash. Never rehashes the contents.
+/// </summary>
+namespace std
+{
+    template<size_t N, LengthPolicy L>
+    struct hash<HashedFixedString<N, L>>
+    {
+        size_t operator()(const HashedFixedString<N, L>& str) const noexcept { return static_cast<size_t>(str.Hash()); }
+    };
+}
+
+
+
+#endif
@@ -0,0 +1,355 @@
+// ============================================================================
+// TextCPP - High Performance String Utility Library
+// ----------------------------------------------------------------------------
+// File:        string_interner.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+
+#ifndef __STRING_INTERNER_H_GUARD
+#define __STRING_INTERNER_H_GUARD
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <memory>
+#include <new>
+
+#include "fixed_string.h"
+
+
+/// <summary>
+/// A compact handle to a string owned by a StringInterner.
+/// Two handles from the same interner are equal exactly when their strings are equal.
+/// </summary>
+struct InternId
+{
+    /// <summary>
+    /// The index of the string within its interner. Invalid() when the handle refers to nothing.
+    /// </summary>
+    uint32_t Value = UINT32_MAX;
+
+    /// <summary>
+    /// Returns the handle that refers to no string.
+    /// </summary>
+    static constexpr InternId Invalid() { return InternId{}; }
+
+    /// <summary>
+    /// True if the handle refers to a string.
+    /// </summary>
+    constexpr bool IsValid() const { return Value != UINT32_MAX; }
+
+    constexpr bool operator==(InternId other) const { return Value == other.Value; }
+    constexpr bool operator!=(InternId other) const { return Value != other.Value; }
+    constexpr bool operator<(InternId other) const { return Value < other.Value; }
+};
+
+
+/// <summary>
+/// Stores each distinct string once in contiguous arena pages and hands out 32-bit InternId handles.
+/// Handles compare as integers, and resolve to a std::string_view or null-terminated C string
+/// without scanning. Interned strings are never moved or freed before the interner is destroyed,
+/// so views and pointers stay valid for its lifetime.
+/// </summary>
+/// <remarks>
+/// Reads are lock-free: Find, View, c_str and length may run concurrently with each other and with
+/// Intern on any thread. Writes are serialized by an internal mutex, so concurrent Intern calls are
+/// safe but single-writer in effect. Find may miss a string that is being interned concurrently.
+/// Superseded index tables are retired rather than freed, so a reader never touches freed memory.
+/// They are released with the interner, which costs at most one extra table's worth of memory.
+/// </remarks>
+class StringInterner
+{
+    public:
+        /// <summary>
+        /// Constructs an empty interner.
+        /// </summary>
+        /// <param name="pageSize">Size in bytes of each arena page. Strings longer than a page get a dedicated page.</param>
+        explicit StringInterner(size_t pageSize = 64 * 1024) : PageSize(pageSize > 0 ? pageSize : 1)
+        {
+            for (auto& chunk : Chunks) chunk.store(nullptr, std::memory_order_relaxed);
+            Table.store(NewTable(InitialTableSize), std::memory_order_relaxed);
+        }
+
+        StringInterner(const StringInterner&) = delete;
+        StringInterner& operator=(const StringInterner&) = delete;
+
+        ~StringInterner()
+        {
+            delete[] reinterpret_cast<char*>(Table.load(std::memory_order_relaxed));
+
+            for (IndexTable* retired : RetiredTables) delete[] reinterpret_cast<char*>(retired);
+            for (auto& chunk : Chunks) delete[] chunk.load(std::memory_order_relaxed);
+        }
+
+        /// <summary>
+        /// Returns the handle for a string, storing it first if it has not been seen before.
+        /// </summary>
+        /// <param name="sv">The string to intern. Must be shorter than 4 GiB.</param>
+        /// <returns>The handle, equal to the handle returned for any previous identical string.</returns>
+        InternId Intern(std::string_view sv)
+        {
+            const uint64_t hash = FixedStringDetail::Hash64(sv.data(), sv.size());
+
+            InternId found = FindHashed(sv, hash);
+            if (found.IsValid()) return found;
+
+            std::lock_guard<std::mutex> lock(WriteLock);
+
+            found = FindHashed(sv, hash);                           // Another writer may have won the race
+            if (found.IsValid()) return found;
+
+            assert(sv.size() < UINT32_MAX && "StringInterner: string too long");
+            assert(Count.load(std::memory_order_relaxed) < UINT32_MAX - 1 && "StringInterner: id space exhausted");
+
+            const uint32_t id = Count.load(std::memory_order_relaxed);
+
+            Entry& entry = EntryAt(id, true);
+            entry.Ptr = StoreBytes(sv);
+            entry.Length = static_cast<uint32_t>(sv.size());
+            entry.Hash = hash;
+
+            Count.store(id + 1, std::memory_order_release);
+            Insert(id, hash);
+
+            return InternId{ id };
+        }
+
+        /// <summary>
+        /// Interns a null-terminated C string. Null pointer is treated as empty string.
+        /// </summary>
+        InternId Intern(const char* str) { return Intern(std::string_view(str ? str : "")); }
+
+        /// <summary>
+        /// Interns the contents of a FixedString of any capacity or policy.
+        /// </summary>
+        template<size_t N, LengthPolicy L>
+        InternId Intern(const FixedString<N, L>& str) { return Intern(static_cast<std::string_view>(str)); }
+
+        /// <summary>
+        /// Looks up a string without interning it. Lock-free.
+        /// </summary>
+        /// <param name="sv">The string to look up.</param>
+        /// <returns>The existing handle, or InternId::Invalid() if the string has not been interned.</returns>
+        InternId Find(std::string_view sv) const { return FindHashed(sv, FixedStringDetail::Hash64(sv.data(), sv.size())); }
+
+        /// <summary>
+        /// Looks up a null-terminated C string without interning it. Null pointer is treated as empty string.
+        /// </summary>
+        InternId Find(const char* str) const { return Find(std::string_view(str ? str : "")); }
+
+        /// <summary>
+        /// Looks up the contents of a FixedString without interning it.
+        /// </summary>
+        template<size_t N, LengthPolicy L>
+        InternId Find(const FixedString<N, L>& str) const { return Find(static_cast<std::string_view>(str)); }
+
+        /// <summary>
+        /// Returns a view of an interned string. O(1), lock-free, no scan.
+        /// </summary>
+        /// <param name="id">A valid handle returned by this interner.</param>
+        std::string_view View(InternId id) const
+        {
+            const Entry& entry = Lookup(id);
+            return std::string_view(entry.Ptr, entry.Length);
+        }
+
+        /// <summary>
+        /// Returns a null-terminated pointer to an interned string. Lock-free.
+        /// </summary>
+        /// <param name="id">A valid handle returned by this interner.</param>
+        const char* c_str(InternId id) const { return Lookup(id).Ptr; }
+
+        /// <summary>
+        /// Returns the length of an interned string. O(1), lock-free.
+        /// </summary>
+        /// <param name="id">A valid handle returned by this interner.</param>
+        size_t length(InternId id) const { return Lookup(id).Length; }
+
+        /// <summary>
+        /// Returns the cached hash of an interned string, equal to FixedString::Hash of the same contents.
+        /// </summary>
+        /// <param name="id">A valid handle returned by this interner.</param>
+        uint64_t Hash(InternId id) const { return Lookup(id).Hash; }
+
+        /// <summary>
+        /// Returns the number of distinct strings interned so far.
+        /// </summary>
+        size_t size() const { return Count.load(std::memory_order_acquire); }
+
+    private:
+        /// <summary>
+        /// Location and hash of one interned string.
+        /// </summary>
+        struct Entry
+        {
+            const char* Ptr;
+            uint32_t Length;
+            uint64_t Hash;
+        };
+
+        /// <summary>
+        /// Open-addressing index from hash to id. Slots hold id + 1, zero marks an empty slot.
+        /// Allocated as one block with the slots following the header.
+        /// </summary>
+        struct IndexTable
+        {
+            size_t Mask;
+            size_t Used;
+            std::atomic<uint32_t>* Slots() { return reinterpret_cast<std::atomic<uint32_t>*>(this + 1); }
+            const std::atomic<uint32_t>* Slots() const { return reinterpret_cast<const std::atomic<uint32_t>*>(this + 1); }
+        };
+
+        static constexpr size_t InitialTableSize = 1024;
+        static constexpr uint32_t FirstChunkShift = 10;                 // The first entry chunk holds 1024 entries
+        static constexpr size_t ChunkCount = 32 - FirstChunkShift + 1;  // Chunk k holds 1024 << k entries
+
+        /// <summary>
+        /// Maps an id to its chunk and offset. Chunk sizes double, so chunks never move and
+        /// 23 of them cover the full 32-bit id space.
+        /// </summary>
+        static void Locate(uint32_t id, size_t* chunk, size_t* offset)
+        {
+            const uint64_t biased = static_cast<uint64_t>(id) + (1ull << FirstChunkShift);
+            size_t bit = 63;
+            while (!(biased >> bit)) --bit;
+
+            *chunk = bit - FirstChunkShift;
+            *offset = static_cast<size_t>(biased - (1ull << bit));
+        }
+
+        const Entry& Lookup(InternId id) const
+        {
+            assert(id.IsValid() && id.Value < Count.load(std::memory_order_acquire) && "StringInterner: invalid id");
+
+            size_t chunk, offset;
+            Locate(id.Value, &chunk, &offset);
+            return Chunks[chunk].load(std::memory_order_acquire)[offset];
+        }
+
+        Entry& EntryAt(uint32_t id, bool allocate)
+        {
+            size_t chunk, offset;
+            Locate(id, &chunk, &offset);
+
+            Entry* entries = Chunks[chunk].load(std::memory_order_relaxed);
+            if (!entries && allocate)
+            {
+                entries = new Entry[(size_t)1 << (chunk + FirstChunkShift)];
+                Chunks[chunk].store(entries, std::memory_order_release);
+            }
+
+            return entries[offset];
+        }
+
+        InternId FindHashed(std::string_view sv, uint64_t hash) const
+        {
+            const IndexTable* table = Table.load(std::memory_order_acquire);
+            const std::atomic<uint32_t>* slots = table->Slots();
+
+            for (size_t i = static_cast<size_t>(hash) & table->Mask; ; i = (i + 1) & table->Mask)
+            {
+                const uint32_t slot = slots[i].load(std::memory_order_acquire);
+                if (slot == 0) return InternId::Invalid();
+
+                const InternId id{ slot - 1 };
+                const Entry& entry = Lookup(id);
+
+                if (entry.Hash == hash && entry.Length == sv.size() && FixedStringDetail::BytesEqual(entry.Ptr, sv.data(), sv.size()))
+                    return id;
+            }
+        }
+
+        /// <summary>
+        /// Copies the bytes plus a null terminator into the current arena page, opening a new page if needed.
+        /// </summary>
+        const char* StoreBytes(std::string_view sv)
+        {
+            const size_t need = sv.size() + 1;
+
+            if (need > PageRemaining)
+            {
+                const size_t size = std::max(need, PageSize);
+                Pages.push_back(std::unique_ptr<char[]>(new char[size]));
+                PageCursor = Pages.back().get();
+                PageRemaining = size;
+            }
+
+            char* out = PageCursor;
+            if (!sv.empty()) std::memcpy(out, sv.data(), sv.size());
+            out[sv.size()] = '\0';
+
+            PageCursor += need;
+            PageRemaining -= need;
+            return out;
+        }
+
+        static IndexTable* NewTable(size_t slotCount)
+        {
+            char* block = new char[sizeof(IndexTable) + slotCount * sizeof(std::atomic<uint32_t>)];
+            IndexTable* table = new (block) IndexTable{ slotCount - 1, 0 };
+
+            std::atomic<uint32_t>* slots = table->Slots();
+            for (size_t i = 0; i < slotCount; ++i) new (&slots[i]) std::atomic<uint32_t>(0);
+
+            return table;
+        }
+
+        static void Place(IndexTable* table, uint32_t id, uint64_t hash)
+        {
+            std::atomic<uint32_t>* slots = table->Slots();
+
+            size_t i = static_cast<size_t>(hash) & table->Mask;
+            while (slots[i].load(std::memory_order_relaxed) != 0) i = (i + 1) & table->Mask;
+
+            slots[i].store(id + 1, std::memory_order_release);
+            ++table->Used;
+        }
+
+        /// <summary>
+        /// Adds an id to the index, growing it first if it would exceed half load. A grown table is
+        /// filled completely before it is published, so readers always see a consistent index.
+        /// </summary>
+        void Insert(uint32_t id, uint64_t hash)
+        {
+            IndexTable* table = Table.load(std::memory_order_relaxed);
+
+            if ((table->Used + 1) * 2 > table->Mask + 1)
+            {
+                IndexTable* grown = NewTable((table->Mask + 1) * 2);
+
+                for (uint32_t i = 0; i < id; ++i) Place(grown, i, EntryAt(i, false).Hash);
+
+                Table.store(grown, std::memory_order_release);
+                RetiredTables.push_back(table);
+                table = grown;
+            }
+
+            Place(table, id, hash);
+        }
+
+        const size_t PageSize;
+
+        std::atomic<IndexTable*> Table;
+        std::atomic<Entry*> Chunks[ChunkCount];
+        std::atomic<uint32_t> Count{ 0 };
+
+        std::mutex WriteLock;                                       // Guards everything below
+        std::vector<std::unique_ptr<char[]>> Pages;
+        char* PageCursor = nullptr;
+        size_t PageRemaining = 0;
+        std::vector<IndexTable*> RetiredTables;
+};
+
+
+
+#endif
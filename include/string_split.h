@@ -0,0 +1,229 @@
+// ============================================================================
+// TextCPP - High Performance String Utility Library
+// ----------------------------------------------------------------------------
+// File:        string_split.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+
+#ifndef __STRING_SPLIT_H_GUARD
+#define __STRING_SPLIT_H_GUARD
+
+#include <iterator>
+#include <string_view>
+
+#include "fixed_string_simd.h"
+
+
+/// <summary>
+/// Splits on a single character. Delimiter positions are found a SIMD block at a time.
+/// </summary>
+struct SplitByChar
+{
+    char Delimiter;
+
+    size_t Find(const char* p, size_t len, size_t readable) const { return FixedStringDetail::FindChar(p, len, Delimiter, readable); }
+    size_t Size() const { return 1; }
+};
+
+/// <summary>
+/// Splits on a multi-character delimiter. An empty delimiter never matches.
+/// </summary>
+struct SplitByString
+{
+    std::string_view Delimiter;
+
+    size_t Find(const char* p, size_t len, size_t readable) const
+    {
+        return Delimiter.empty() ? std::string_view::npos : FixedStringDetail::FindString(p, len, Delimiter.data(), Delimiter.size(), readable);
+    }
+
+    size_t Size() const { return Delimiter.size(); }
+};
+
+/// <summary>
+/// Splits on any one of a set of characters. Sets of up to four characters are matched a SIMD block at a time.
+/// </summary>
+struct SplitByAnyOf
+{
+    std::string_view Set;
+
+    size_t Find(const char* p, size_t len, size_t readable) const { return FixedStringDetail::FindFirstOf(p, len, Set, readable); }
+    size_t Size() const { return 1; }
+};
+
+/// <summary>
+/// Marks a split delimiter as a set of characters rather than a multi-character string.
+/// </summary>
+/// <example>Split(line, SplitAnyOf(" \t,"))</example>
+inline SplitByAnyOf SplitAnyOf(std::string_view set) { return SplitByAnyOf{ set }; }
+
+
+/// <summary>
+/// A lazy, allocation-free range of the tokens between delimiters in a string.
+/// Each token is a std::string_view into the original text, which must outlive the range.
+/// Adjacent delimiters yield empty tokens unless SkipEmpty is set, and an empty text yields
+/// one empty token, matching the usual split semantics.
+/// </summary>
+/// <typeparam name="Delimiter">SplitByChar, SplitByString or SplitByAnyOf.</typeparam>
+template<typename Delimiter>
+class SplitRange
+{
+    public:
+        /// <summary>
+        /// Iterator over the tokens. Tokens are returned by value, so under the C++17 iterator
+        /// requirements this is an input iterator; it is multi-pass, which C++20 ranges see through
+        /// iterator_concept.
+        /// </summary>
+        class iterator
+        {
+            public:
+                /// <summary>
+                /// Holds the token for operator->, which cannot point into the range.
+                /// </summary>
+                struct ArrowProxy
+                {
+                    std::string_view Token;
+                    const std::string_view* operator->() const { return &Token; }
+                };
+
+                using iterator_category = std::input_iterator_tag;
+                using iterator_concept = std::forward_iterator_tag;
+                using value_type = std::string_view;
+                using difference_type = std::ptrdiff_t;
+                using pointer = ArrowProxy;
+                using reference = std::string_view;
+
+                iterator() = default;
+
+                std::string_view operator*() const { return std::string_view(Range->Text + Begin, End - Begin); }
+                ArrowProxy operator->() const { return ArrowProxy{ **this }; }
+
+                iterator& operator++() { Advance(); return *this; }
+                iterator operator++(int) { iterator old = *this; Advance(); return old; }
+
+                bool operator==(const iterator& other) const { return Done == other.Done && (Done || Begin == other.Begin); }
+                bool operator!=(const iterator& other) const { return !(*this == other); }
+
+            private:
+                friend class SplitRange;
+
+                explicit iterator(const SplitRange* range) : Range(range), Done(false)
+                {
+                    Locate(0);
+                    SkipEmptyTokens();
+                }
+
+                /// <summary>
+                /// Sets the current token to start at from and end at the next delimiter or the end of the text.
+                /// </summary>
+                void Locate(size_t from)
+                {
+                    Begin = from;
+
+                    const size_t at = Range->Split.Find(Range->Text + from, Range->Length - from, Range->Readable - from);
+
+                    Last = at == std::string_view::npos;
+                    End = Last ? Range->Length : from + at;
+                }
+
+                void Advance()
+                {
+                    if (Last) { Done = true; return; }
+
+                    Locate(End + Range->Split.Size());
+                    SkipEmptyTokens();
+                }
+
+                void SkipEmptyTokens()
+                {
+                    if (!Range->SkipEmpty) return;
+
+                    while (Begin == End)
+                    {
+                        if (Last) { Done = true; return; }
+                        Locate(End + Range->Split.Size());
+                    }
+                }
+
+                const SplitRange* Range = nullptr;
+                size_t Begin = 0;
+                size_t End = 0;
+                bool Last = true;
+                bool Done = true;
+        };
+
+        /// <summary>
+        /// Constructs a range over text.
+        /// </summary>
+        /// <param name="text">The text to split.</param>
+        /// <param name="split">The delimiter.</param>
+        /// <param name="skipEmpty">If true, empty tokens are not yielded.</param>
+        /// <param name="readable">Bytes readable from text.data(), at least text.size(). Lets
+        /// FixedString sources scan whole buffer blocks. Defaults to text.size().</param>
+        SplitRange(std::string_view text, Delimiter split, bool skipEmpty = false, size_t readable = 0)
+            : Text(text.data()), Length(text.size()), Readable(readable > text.size() ? readable : text.size()), Split(split), SkipEmpty(skipEmpty) {}
+
+        iterator begin() const { return iterator(this); }
+        iterator end() const { return iterator(); }
+
+        /// <summary>
+        /// Returns a copy of this range that does not yield empty tokens.
+        /// </summary>
+        SplitRange SkipEmptyTokens() const { SplitRange copy = *this; copy.SkipEmpty = true; return copy; }
+
+        /// <summary>
+        /// Counts the tokens without materializing them.
+        /// </summary>
+        size_t Count() const
+        {
+            size_t count = 0;
+            for (auto it = begin(); it != end(); ++it) ++count;
+            return count;
+        }
+
+    private:
+        const char* Text;
+        size_t Length;
+        size_t Readable;
+        Delimiter Split;
+        bool SkipEmpty;
+};
+
+
+/// <summary>
+/// Splits text on a single character.
+/// </summary>
+inline SplitRange<SplitByChar> Split(std::string_view text, char delimiter, bool skipEmpty = false)
+{
+    return SplitRange<SplitByChar>(text, SplitByChar{ delimiter }, skipEmpty);
+}
+
+/// <summary>
+/// Splits text on a multi-character delimiter.
+/// </summary>
+inline SplitRange<SplitByString> Split(std::string_view text, std::string_view delimiter, bool skipEmpty = false)
+{
+    return SplitRange<SplitByString>(text, SplitByString{ delimiter }, skipEmpty);
+}
+
+/// <summary>
+/// Splits text on any character of a set. Use SplitAnyOf to build the set.
+/// </summary>
+inline SplitRange<SplitByAnyOf> Split(std::string_view text, SplitByAnyOf delimiters, bool skipEmpty = false)
+{
+    return SplitRange<SplitByAnyOf>(text, delimiters, skipEmpty);
+}
+
+
+
+#endif
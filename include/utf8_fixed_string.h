@@ -0,0 +1,385 @@
+// ============================================================================
+// TextCPP - High Performance String Utility Library
+// ----------------------------------------------------------------------------
+// File:        utf8_fixed_string.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+
+#ifndef __UTF8_FIXED_STRING_H_GUARD
+#define __UTF8_FIXED_STRING_H_GUARD
+
+#include "fixed_string.h"
+
+
+namespace FixedStringDetail
+{
+    /// <summary>
+    /// True for a UTF-8 continuation byte (10xxxxxx).
+    /// </summary>
+    constexpr bool IsContinuation(char c) { return (static_cast<unsigned char>(c) & 0xC0) == 0x80; }
+
+    /// <summary>
+    /// Length of the well-formed UTF-8 sequence at p[0, available), or 0 if it is malformed, overlong,
+    /// a surrogate, above U+10FFFF or cut off by the end of the input.
+    /// </summary>
+    inline size_t Utf8SequenceLength(const char* p, size_t available)
+    {
+        const unsigned char lead = static_cast<unsigned char>(p[0]);
+
+        if (lead < 0x80) return 1;
+        if (lead < 0xC2) return 0;                              // Continuation byte, or overlong 2-byte form
+
+        const size_t length = lead < 0xE0 ? 2 : lead < 0xF0 ? 3 : lead < 0xF5 ? 4 : 0;
+        if (length == 0 || available < length) return 0;
+
+        unsigned char low = 0x80, high = 0xBF;                  // Allowed range of the second byte
+
+        if (lead == 0xE0) low = 0xA0;                           // Overlong 3-byte form
+        else if (lead == 0xED) high = 0x9F;                     // Surrogates
+        else if (lead == 0xF0) low = 0x90;                      // Overlong 4-byte form
+        else if (lead == 0xF4) high = 0x8F;                     // Above U+10FFFF
+
+        const unsigned char second = static_cast<unsigned char>(p[1]);
+        if (second < low || second > high) return 0;
+
+        for (size_t i = 2; i < length; ++i)
+        {
+            if (!IsContinuation(p[i])) return 0;
+        }
+
+        return length;
+    }
+
+    /// <summary>
+    /// Length of the longest valid UTF-8 prefix of p[0, len); len if all of it is valid.
+    /// ASCII runs are skipped a SIMD block at a time; only multi-byte sequences are decoded.
+    /// </summary>
+    inline size_t ValidUtf8Prefix(const char* p, size_t len)
+    {
+        size_t i = 0;
+
+        while (i < len)
+        {
+            for (; i + SimdWidth <= len; i += SimdWidth)
+            {
+                const uint64_t mask = SimdHighBytes(p + i);
+
+                if (mask) {
+                    i += LowestBit(mask) / SimdMaskBits;
+                    break;
+                }
+            }
+
+            while (i < len && static_cast<unsigned char>(p[i]) < 0x80) ++i;
+            if (i == len) break;
+
+            const size_t length = Utf8SequenceLength(p + i, len - i);
+            if (length == 0) return i;
+
+            i += length;
+        }
+
+        return len;
+    }
+
+    /// <summary>
+    /// The largest cut point no greater than max that does not split a codepoint of the valid UTF-8 text p[0, len).
+    /// </summary>
+    inline size_t Utf8Boundary(const char* p, size_t len, size_t max)
+    {
+        if (len <= max) return len;
+
+        size_t cut = max;
+        while (cut > 0 && IsContinuation(p[cut])) --cut;
+        return cut;
+    }
+
+    /// <summary>
+    /// Number of codepoints in the valid UTF-8 text p[0, len): the bytes that are not continuation bytes,
+    /// counted a word at a time.
+    /// </summary>
+    inline size_t CountCodepoints(const char* p, size_t len)
+    {
+        size_t continuations = 0;
+        size_t i = 0;
+
+        for (; i + 8 <= len; i += 8)
+        {
+            const uint64_t x = Load64(p + i);
+            continuations += PopCount64(x & ~(x << 1) & 0x8080808080808080ull);     // Bit 7 set, bit 6 clear
+        }
+
+        for (; i < len; ++i) continuations += IsContinuation(p[i]);
+
+        return len - continuations;
+    }
+}
+
+
+/// <summary>
+/// True if sv is well-formed UTF-8: no overlong forms, surrogates or codepoints above U+10FFFF.
+/// </summary>
+inline bool IsValidUtf8(std::string_view sv) { return FixedStringDetail::ValidUtf8Prefix(sv.data(), sv.size()) == sv.size(); }
+
+/// <summary>
+/// Number of codepoints in sv, which must be valid UTF-8.
+/// </summary>
+inline size_t CodepointCount(std::string_view sv) { return FixedStringDetail::CountCodepoints(sv.data(), sv.size()); }
+
+/// <summary>
+/// The longest prefix of the valid UTF-8 text sv that is at most maxBytes long and ends on a codepoint boundary.
+/// </summary>
+inline std::string_view Utf8Truncate(std::string_view sv, size_t maxBytes)
+{
+    return sv.substr(0, FixedStringDetail::Utf8Boundary(sv.data(), sv.size(), maxBytes));
+}
+
+
+/// <summary>
+/// What Utf8FixedString::Assign did with its input.
+/// </summary>
+enum class Utf8Status
+{
+    /// <summary>
+    /// The input was valid UTF-8 and was stored whole.
+    /// </summary>
+    Valid,
+
+    /// <summary>
+    /// The input was valid UTF-8 but too long; it was cut at the last codepoint boundary that fits.
+    /// </summary>
+    Truncated,
+
+    /// <summary>
+    /// The input was not valid UTF-8; only the part before the first invalid sequence was kept.
+    /// </summary>
+    Invalid
+};
+
+
+/// <summary>
+/// A FixedString that always holds valid UTF-8. Every assignment validates its input, skipping ASCII a
+/// SIMD block at a time, and a string too long for the buffer is cut on a codepoint boundary, never inside
+/// a multi-byte sequence. Because validity is part of the type, strings that arrive as a Utf8FixedString
+/// are never validated again: copies and conversions between capacities only find a boundary.
+/// The contents are read-only except through assignment, which keeps them valid.
+/// </summary>
+/// <remarks>
+/// Unlike FixedString, assignment does not assert on long input: truncation and invalid input are
+/// reported by Assign's Utf8Status, since both are expected of text from outside the program.
+/// </remarks>
+/// <typeparam name="N">The total buffer size in bytes, including the null terminator.</typeparam>
+/// <typeparam name="L">How the length is tracked. See LengthPolicy.</typeparam>
+template<size_t N, LengthPolicy L = LengthPolicy::Scan>
+class Utf8FixedString
+{
+    public:
+        /// <summary>
+        /// Default constructor. Holds an empty string.
+        /// </summary>
+        Utf8FixedString() = default;
+
+        /// <summary>
+        /// Constructs from a null-terminated C string. Null pointer is treated as empty string.
+        /// See Assign for how invalid or long input is stored.
+        /// </summary>
+        Utf8FixedString(const char* str) { Assign(str); }
+
+        /// <summary>
+        /// Constructs from a std::string. See Assign.
+        /// </summary>
+        Utf8FixedString(const std::string& str) { Assign(std::string_view(str)); }
+
+        /// <summary>
+        /// Constructs from a std::string_view. See Assign.
+        /// </summary>
+        Utf8FixedString(std::string_view sv) { Assign(sv); }
+
+        /// <summary>
+        /// Constructs from a FixedString of any capacity or policy, validating its contents. See Assign.
+        /// </summary>
+        template<size_t M, LengthPolicy LM>
+        explicit Utf8FixedString(const FixedString<M, LM>& str) { Assign(static_cast<std::string_view>(str)); }
+
+        /// <summary>
+        /// Constructs from a Utf8FixedString of another capacity or policy without validating again.
+        /// A longer string is cut on a codepoint boundary.
+        /// </summary>
+        template<size_t M, LengthPolicy LM, typename = std::enable_if_t<M != N || LM != L>>
+        Utf8FixedString(const Utf8FixedString<M, LM>& str) { Assign(str); }
+
+        /// <summary>
+        /// Assigns from a null-terminated C string. See Assign.
+        /// </summary>
+        Utf8FixedString& operator=(const char* str) { Assign(str); return *this; }
+
+        /// <summary>
+        /// Assigns from a std::string. See Assign.
+        /// </summary>
+        Utf8FixedString& operator=(const std::string& str) { Assign(std::string_view(str)); return *this; }
+
+        /// <summary>
+        /// Assigns from a std::string_view. See Assign.
+        /// </summary>
+        Utf8FixedString& operator=(std::string_view sv) { Assign(sv); return *this; }
+
+        /// <summary>
+        /// Assigns from a Utf8FixedString of another capacity or policy without validating again.
+        /// </summary>
+        template<size_t M, LengthPolicy LM, typename = std::enable_if_t<M != N || LM != L>>
+        Utf8FixedString& operator=(const Utf8FixedString<M, LM>& str) { Assign(str); return *this; }
+
+        /// <summary>
+        /// Validates and stores sv. Input with an invalid sequence keeps the part before it; input longer
+        /// than N - 1 bytes is cut at the last codepoint boundary that fits.
+        /// </summary>
+        /// <returns>Whether sv was stored whole, cut to fit, or cut at invalid UTF-8.</returns>
+        Utf8Status Assign(std::string_view sv)
+        {
+            const size_t valid = FixedStringDetail::ValidUtf8Prefix(sv.data(), sv.size());
+            const size_t length = FixedStringDetail::Utf8Boundary(sv.data(), valid, N - 1);
+
+            Value.Assign(std::string_view(sv.data(), length));
+
+            if (valid < sv.size()) return Utf8Status::Invalid;
+            return length < valid ? Utf8Status::Truncated : Utf8Status::Valid;
+        }
+
+        /// <summary>
+        /// Validates and stores a null-terminated C string. Null pointer is treated as empty string.
+        /// </summary>
+        Utf8Status Assign(const char* str) { return Assign(str ? std::string_view(str) : std::string_view()); }
+
+        /// <summary>
+        /// Stores another Utf8FixedString without validating it again.
+        /// </summary>
+        /// <returns>Valid, or Truncated if it was cut to fit.</returns>
+        template<size_t M, LengthPolicy LM>
+        Utf8Status Assign(const Utf8FixedString<M, LM>& str)
+        {
+            const std::string_view sv = str;
+            const size_t length = FixedStringDetail::Utf8Boundary(sv.data(), sv.size(), N - 1);
+
+            Value.Assign(std::string_view(sv.data(), length));
+            return length < sv.size() ? Utf8Status::Truncated : Utf8Status::Valid;
+        }
+
+        /// <summary>
+        /// Number of codepoints. Counted a word at a time, with no validation.
+        /// </summary>
+        size_t CodepointCount() const { return FixedStringDetail::CountCodepoints(Value.c_str(), Value.length()); }
+
+        /// <summary>
+        /// Returns the hash of the contents. Equal to String().Hash().
+        /// </summary>
+        uint64_t Hash() const { return Value.Hash(); }
+
+        /// <summary>
+        /// Returns the underlying FixedString, for its read-only operations.
+        /// </summary>
+        const FixedString<N, L>& String() const { return Value; }
+
+        /// <summary>
+        /// Returns a null-terminated pointer to the internal buffer.
+        /// </summary>
+        const char* c_str() const { return Value.c_str(); }
+
+        /// <summary>
+        /// Returns the length in bytes. See FixedString::length.
+        /// </summary>
+        size_t length() const { return Value.length(); }
+
+        /// <summary>
+        /// Returns true if the string is empty.
+        /// </summary>
+        bool empty() const { return Value.empty(); }
+
+        /// <summary>
+        /// Implicit conversion to the underlying FixedString.
+        /// </summary>
+        operator const FixedString<N, L>& () const { return Value; }
+
+        /// <summary>
+        /// Implicit conversion to std::string_view. Does not allocate.
+        /// </summary>
+        operator std::string_view() const { return Value; }
+
+        /// <summary>
+        /// Equality comparison by contents.
+        /// </summary>
+        template<size_t M, LengthPolicy LM>
+        bool operator==(const Utf8FixedString<M, LM>& other) const { return Value == other.String(); }
+
+        /// <summary>
+        /// Inequality comparison by contents.
+        /// </summary>
+        template<size_t M, LengthPolicy LM>
+        bool operator!=(const Utf8FixedString<M, LM>& other) const { return !(*this == other); }
+
+        /// <summary>
+        /// Equality comparison against a FixedString of any capacity or policy.
+        /// </summary>
+        template<size_t M, LengthPolicy LM>
+        bool operator==(const FixedString<M, LM>& other) const { return Value == other; }
+
+        /// <summary>
+        /// Inequality comparison against a FixedString of any capacity or policy.
+        /// </summary>
+        template<size_t M, LengthPolicy LM>
+        bool operator!=(const FixedString<M, LM>& other) const { return Value != other; }
+
+        /// <summary>
+        /// Equality comparison against a std::string_view.
+        /// </summary>
+        bool operator==(std::string_view other) const { return Value == other; }
+
+        /// <summary>
+        /// Inequality comparison against a std::string_view.
+        /// </summary>
+        bool operator!=(std::string_view other) const { return Value != other; }
+
+        /// <summary>
+        /// Equality comparison against a null-terminated C string. A null pointer is never considered equal.
+        /// </summary>
+        bool operator==(const char* other) const { return Value == other; }
+
+        /// <summary>
+        /// Inequality comparison against a null-terminated C string.
+        /// </summary>
+        bool operator!=(const char* other) const { return Value != other; }
+
+        /// <summary>
+        /// Lexicographic ordering by bytes, which for UTF-8 is also codepoint order.
+        /// </summary>
+        bool operator<(const Utf8FixedString& other) const { return Value < other.Value; }
+
+    private:
+        FixedString<N, L> Value;
+};
+
+
+/// <summary>
+/// std::hash specialization matching FixedString: equal contents hash equally.
+/// </summary>
+namespace std
+{
+    template<size_t N, LengthPolicy L>
+    struct hash<Utf8FixedString<N, L>>
+    {
+        size_t operator()(const Utf8FixedString<N, L>& str) const noexcept { return static_cast<size_t>(str.Hash()); }
+    };
+}
+
+
+
+#endif
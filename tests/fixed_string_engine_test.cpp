@@ -0,0 +1,288 @@
+// ============================================================================
+// TextCPP - High Performance String Utility Library
+// ----------------------------------------------------------------------------
+// File:        fixed_string_engine_test.cpp
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#include "fixed_string.h"
+#include "fixed_string_batch.h"
+#include "fixed_string_matcher.h"
+#include "utf8_fixed_string.h"
+#include "test_support.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <charconv>
+#include <tuple>
+
+
+/// <summary>
+/// Differential tests of the engines behind FixedString and its companions, each against a plain
+/// reference: the SIMD kernels on misaligned views, the SWAR integer parser, the radix sort,
+/// the Aho-Corasick matcher and the UTF-8 validator.
+/// </summary>
+namespace
+{
+    /// <summary>
+    /// Decodes one UTF-8 sequence the slow way. Returns its length, or 0 if it is not well-formed.
+    /// </summary>
+    size_t ReferenceSequence(std::string_view text, size_t i)
+    {
+        const unsigned char lead = static_cast<unsigned char>(text[i]);
+        size_t length;
+        uint32_t codepoint;
+
+        if (lead < 0x80) return 1;
+        else if ((lead & 0xE0) == 0xC0) { length = 2; codepoint = lead & 0x1F; }
+        else if ((lead & 0xF0) == 0xE0) { length = 3; codepoint = lead & 0x0F; }
+        else if ((lead & 0xF8) == 0xF0) { length = 4; codepoint = lead & 0x07; }
+        else return 0;
+
+        if (i + length > text.size()) return 0;
+
+        for (size_t k = 1; k < length; ++k)
+        {
+            const unsigned char next = static_cast<unsigned char>(text[i + k]);
+            if ((next & 0xC0) != 0x80) return 0;
+            codepoint = (codepoint << 6) | (next & 0x3F);
+        }
+
+        static const uint32_t Smallest[] = { 0, 0, 0x80, 0x800, 0x10000 };
+        if (codepoint < Smallest[length] || codepoint > 0x10FFFF || (codepoint >= 0xD800 && codepoint <= 0xDFFF)) return 0;
+
+        return length;
+    }
+
+    /// <summary>
+    /// Length of the longest valid UTF-8 prefix, and the number of codepoints in it.
+    /// </summary>
+    std::pair<size_t, size_t> ReferenceUtf8(std::string_view text)
+    {
+        size_t i = 0, codepoints = 0;
+
+        while (i < text.size())
+        {
+            const size_t length = ReferenceSequence(text, i);
+            if (length == 0) break;
+
+            i += length;
+            ++codepoints;
+        }
+
+        return { i, codepoints };
+    }
+
+    /// <summary>
+    /// Mostly valid UTF-8 of every sequence length, with the occasional stray, overlong, surrogate or
+    /// too-large sequence or an encoding cut short.
+    /// </summary>
+    std::string Utf8Text(TestRandom& random, size_t pieces)
+    {
+        static const char* const Samples[] = {
+            "a", "Z", "~", "\xC3\xA9", "\xDF\xBF", "\xE2\x82\xAC", "\xED\x9F\xBF", "\xEF\xBF\xBD", "\xF0\x9F\x98\x80", "\xF4\x8F\xBF\xBF",
+            "\x80", "\xC0\xAF", "\xE0\x80\xAF", "\xED\xA0\x80", "\xF4\x90\x80\x80", "\xF8\x88\x80\x80\x80", "\xE2\x82", "\xFF" };
+        constexpr size_t ValidSamples = 10;
+
+        std::string text;
+        for (size_t i = 0; i < pieces; ++i)
+        {
+            const size_t pick = random.OneIn(16) ? random.Between(ValidSamples, std::size(Samples) - 1) : random.Between(0, ValidSamples - 1);
+            text += Samples[pick];
+        }
+
+        return text;
+    }
+
+    /// <summary>
+    /// Every occurrence of every pattern, sorted by position and then id.
+    /// </summary>
+    std::vector<std::pair<size_t, uint32_t>> ReferenceMatches(const std::vector<std::string>& patterns, std::string_view text)
+    {
+        std::vector<std::pair<size_t, uint32_t>> hits;
+
+        for (uint32_t id = 0; id < patterns.size(); ++id)
+        {
+            for (size_t at = text.find(patterns[id]); at != std::string_view::npos; at = text.find(patterns[id], at + 1)) hits.emplace_back(at, id);
+        }
+
+        std::sort(hits.begin(), hits.end());
+        return hits;
+    }
+
+    template<typename T>
+    void ExpectParsesLikeFromChars(const std::string& text)
+    {
+        const FixedString<32> str(text);
+        T fast = 7, reference = 7;
+
+        const std::from_chars_result fastResult = str.ParseNumber(fast);
+        const std::from_chars_result referenceResult = std::from_chars(text.data(), text.data() + text.size(), reference);
+
+        ASSERT_EQ(fastResult.ec, referenceResult.ec) << text;
+        ASSERT_EQ(fastResult.ptr - str.c_str(), referenceResult.ptr - text.data()) << text;
+        ASSERT_EQ(fast, reference) << text;
+        ASSERT_TRUE(str.ParseInt<T>() == (referenceResult.ec == std::errc() && referenceResult.ptr == text.data() + text.size() ? std::optional<T>(reference) : std::nullopt)) << text;
+    }
+
+    template<typename T>
+    void ExpectSortsLikeStdSort(TestRandom& random, size_t count, unsigned threads)
+    {
+        std::vector<T> items(count);
+        for (T& item : items) item.Assign(random.Text(random.Between(0, std::min<size_t>(sizeof(T) - 1, 20))));
+
+        std::vector<std::string> reference(items.begin(), items.end());
+        std::sort(reference.begin(), reference.end());
+
+        std::vector<T> sorted = items;
+        RadixSort(sorted.data(), sorted.size(), threads);
+        ASSERT_TRUE(std::equal(sorted.begin(), sorted.end(), reference.begin(), reference.end(), [](const T& a, const std::string& b) { return a == b; }));
+
+        reference.erase(std::unique(reference.begin(), reference.end()), reference.end());
+
+        const size_t kept = SortUnique(items.data(), items.size(), threads);
+        ASSERT_TRUE(std::equal(items.begin(), items.begin() + kept, reference.begin(), reference.end(), [](const T& a, const std::string& b) { return a == b; }));
+    }
+}
+
+
+TEST(SimdKernelTest, MisalignedViewsMatchStringView)
+{
+    TestRandom random(1);
+
+    for (int c = 0; c < 4000; ++c)
+    {
+        const std::string text = random.Text(random.Between(0, 100));
+        const UnalignedText unaligned(text, random.Between(0, 7));
+        const std::string_view view = unaligned.View();
+        const char* p = view.data();
+        const size_t len = view.size();
+
+        const char probe = random.Byte();
+        const std::string set = random.Text(random.Between(0, 6));
+        const std::string needle = random.Text(random.Between(0, 5));
+
+        ASSERT_EQ(FixedStringDetail::FindChar(p, len, probe, len), view.find(probe));
+        ASSERT_EQ(FixedStringDetail::RFindChar(p, len, probe), view.rfind(probe));
+        ASSERT_EQ(FixedStringDetail::FindString(p, len, needle.data(), needle.size(), len), view.find(needle));
+        ASSERT_EQ(FixedStringDetail::FindFirstOf(p, len, set, len), view.find_first_of(set));
+        ASSERT_EQ(FixedStringDetail::FindFirstNotOf(p, len, set, len), view.find_first_not_of(set));
+    }
+}
+
+
+TEST(SwarParseTest, IntegersMatchFromChars)
+{
+    TestRandom random(2);
+
+    for (int c = 0; c < 20000; ++c)
+    {
+        std::string text;
+        if (random.OneIn(3)) text += '-';
+
+        const size_t digits = random.Between(0, 20);
+        for (size_t i = 0; i < digits; ++i) text += static_cast<char>('0' + random.Between(0, 9));
+        if (random.OneIn(8)) text.insert(random.Between(0, text.size()), 1, "+x 9."[random.Between(0, 4)]);
+
+        ExpectParsesLikeFromChars<int64_t>(text);
+        ExpectParsesLikeFromChars<uint64_t>(text);
+        ExpectParsesLikeFromChars<int32_t>(text);
+        ExpectParsesLikeFromChars<uint16_t>(text);
+        ExpectParsesLikeFromChars<int8_t>(text);
+    }
+}
+
+
+TEST(RadixSortTest, MatchesStdSortAndUnique)
+{
+    TestRandom random(3);
+
+    for (size_t count : { 0, 1, 2, 3, 17, 255, 256, 1000, 5000 })
+    {
+        for (unsigned threads : { 1u, 3u })
+        {
+            ExpectSortsLikeStdSort<FixedString<8>>(random, count, threads);
+            ExpectSortsLikeStdSort<FixedString<16, LengthPolicy::Stored>>(random, count, threads);
+            ExpectSortsLikeStdSort<FixedString<33>>(random, count, threads);
+        }
+    }
+}
+
+
+TEST(MatcherTest, ScanFindsEveryOccurrence)
+{
+    TestRandom random(4);
+
+    for (int c = 0; c < 400; ++c)
+    {
+        std::vector<std::string> patterns(random.Between(1, 12));
+        for (std::string& pattern : patterns) pattern = random.Text(random.Between(1, 6));
+
+        FixedStringMatcher matcher;
+        for (const std::string& pattern : patterns) matcher.Add(pattern);
+        matcher.Build();
+
+        for (int t = 0; t < 10; ++t)
+        {
+            const std::string text = random.Text(random.Between(0, 300));
+            const std::vector<std::pair<size_t, uint32_t>> expected = ReferenceMatches(patterns, text);
+
+            std::vector<std::pair<size_t, uint32_t>> hits;
+            matcher.Scan(text, [&hits](MatcherHit hit) { hits.emplace_back(hit.Position, hit.Id); });
+            std::sort(hits.begin(), hits.end());
+
+            ASSERT_EQ(hits, expected);
+            ASSERT_EQ(matcher.Count(text), expected.size());
+            ASSERT_EQ(matcher.Contains(text), !expected.empty());
+
+            const std::optional<MatcherHit> first = matcher.FindFirst(text);
+            ASSERT_EQ(first.has_value(), !expected.empty());
+
+            if (first)
+            {
+                size_t firstEnd = std::string::npos;
+                for (const auto& [position, id] : expected) firstEnd = std::min(firstEnd, position + patterns[id].size());
+                ASSERT_EQ(first->Position + patterns[first->Id].size(), firstEnd);
+            }
+        }
+    }
+}
+
+
+TEST(Utf8Test, ValidationMatchesReferenceDecoder)
+{
+    TestRandom random(5);
+
+    for (int c = 0; c < 20000; ++c)
+    {
+        const std::string text = Utf8Text(random, random.Between(0, 40));
+        const auto [validLength, codepoints] = ReferenceUtf8(text);
+        const bool valid = validLength == text.size();
+
+        ASSERT_EQ(IsValidUtf8(text), valid);
+
+        const std::string_view prefix = std::string_view(text).substr(0, validLength);
+        ASSERT_EQ(CodepointCount(prefix), codepoints);
+
+        const size_t maxBytes = random.Between(0, prefix.size());
+        const std::string_view cut = Utf8Truncate(prefix, maxBytes);
+        ASSERT_LE(cut.size(), maxBytes);
+        ASSERT_TRUE(IsValidUtf8(cut));
+        ASSERT_TRUE(cut.size() == prefix.size() || cut.size() + ReferenceSequence(prefix, cut.size()) > maxBytes);
+
+        Utf8FixedString<32> str;
+        const Utf8Status status = str.Assign(text);
+        const std::string_view stored = Utf8Truncate(prefix, 31);
+
+        ASSERT_TRUE(str == stored);
+        ASSERT_EQ(status, !valid ? Utf8Status::Invalid : stored.size() < text.size() ? Utf8Status::Truncated : Utf8Status::Valid);
+    }
+}
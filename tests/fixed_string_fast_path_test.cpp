@@ -0,0 +1,202 @@
+// ============================================================================
+// TextCPP - High Performance String Utility Library
+// ----------------------------------------------------------------------------
+// File:        fixed_string_fast_path_test.cpp
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#include "fixed_string.h"
+#include "test_support.h"
+
+#include <gtest/gtest.h>
+
+#include <new>
+
+
+/// <summary>
+/// Random contents of every length up to N - 1 in FixedStrings placed at offsets 0 to 7, checked against
+/// std::string_view over the same text. The build also sets FIXED_STRING_VERIFY_FAST_PATHS, so every
+/// call below additionally checks itself against its own reference and aborts on a disagreement.
+/// </summary>
+namespace
+{
+    constexpr int CasesPerType = 150;
+
+    int Sign(int x) { return (x > 0) - (x < 0); }
+
+    template<typename T> struct Shape;
+
+    template<size_t N, LengthPolicy L>
+    struct Shape<FixedString<N, L>>
+    {
+        static constexpr size_t Capacity = N - 1;               // Characters that fit
+        static constexpr uint32_t Seed = static_cast<uint32_t>(N * 2 + (L == LengthPolicy::Stored ? 1 : 0));
+    };
+
+    /// <summary>
+    /// A FixedString constructed at offset bytes into aligned storage, so the fast paths see every
+    /// alignment of the buffer.
+    /// </summary>
+    template<typename T>
+    class PlacedString
+    {
+        public:
+            explicit PlacedString(size_t offset) : Str(new (Storage + offset) T()) {}
+
+            T& operator*() { return *Str; }
+            T* operator->() { return Str; }
+
+        private:
+            alignas(64) unsigned char Storage[sizeof(T) + 8];
+            T* Str;
+    };
+
+    /// <summary>
+    /// Stores text in str as a caller writing Data directly would: stale non-zero bytes fill the whole
+    /// buffer and the terminator is embedded after the contents. Stored types also need SetLength.
+    /// </summary>
+    template<size_t N, LengthPolicy L>
+    void StoreOverStaleBytes(FixedString<N, L>& str, std::string_view text, TestRandom& random)
+    {
+        for (size_t i = 0; i < N; ++i) str.Data[i] = random.Byte();
+        std::memcpy(str.Data, text.data(), text.size());
+        str.Data[text.size()] = '\0';
+
+        if constexpr (L == LengthPolicy::Stored) str.SetLength(text.size());
+    }
+
+    /// <summary>
+    /// Another text to compare with: equal, a prefix or extension, one byte changed, or unrelated.
+    /// </summary>
+    std::string OtherText(const std::string& text, size_t capacity, TestRandom& random)
+    {
+        std::string other = text;
+
+        switch (random.Between(0, 4))
+        {
+            case 0: break;
+            case 1: other.resize(random.Between(0, text.size())); break;
+            case 2: if (other.size() < capacity) other += random.Text(random.Between(1, capacity - other.size())); break;
+            case 3: if (!other.empty()) other[random.Between(0, other.size() - 1)] = random.Byte(); break;
+            default: other = random.Text(random.Length(capacity)); break;
+        }
+
+        return other;
+    }
+
+    template<typename T>
+    class FastPathTest : public ::testing::Test {};
+
+    template<size_t N> using Scan = FixedString<N>;
+    template<size_t N> using Stored = FixedString<N, LengthPolicy::Stored>;
+
+    using Capacities = ::testing::Types<
+        Scan<1>, Scan<2>, Scan<3>, Scan<7>, Scan<8>, Scan<9>, Scan<15>, Scan<16>, Scan<17>, Scan<31>, Scan<32>, Scan<33>,
+        Scan<63>, Scan<64>, Scan<65>, Scan<127>, Scan<128>, Scan<129>, Scan<255>, Scan<256>, Scan<257>, Scan<1024>,
+        Stored<1>, Stored<2>, Stored<7>, Stored<8>, Stored<9>, Stored<15>, Stored<16>, Stored<17>, Stored<31>, Stored<32>,
+        Stored<33>, Stored<64>, Stored<65>, Stored<128>, Stored<255>, Stored<256>>;
+
+    TYPED_TEST_SUITE(FastPathTest, Capacities);
+}
+
+
+TYPED_TEST(FastPathTest, MatchesStringView)
+{
+    using String = TypeParam;
+    constexpr size_t Capacity = Shape<String>::Capacity;
+
+    TestRandom random(Shape<String>::Seed);
+
+    for (int c = 0; c < CasesPerType; ++c)
+    {
+        const std::string text = random.Text(random.Length(Capacity));
+        const std::string other = OtherText(text, Capacity, random);
+        const std::string_view view(text);
+
+        for (size_t offset = 0; offset < 8; ++offset)
+        {
+            PlacedString<String> placed(offset);
+            String& str = *placed;
+            StoreOverStaleBytes(str, text, random);
+
+            const UnalignedText unaligned(other, 7 - offset);
+            const std::string_view otherView = unaligned.View();
+            PlacedString<String> otherPlaced(7 - offset);
+            StoreOverStaleBytes(*otherPlaced, other, random);
+
+            ASSERT_EQ(str.length(), text.size());
+            ASSERT_EQ(static_cast<std::string_view>(str), view);
+
+            ASSERT_TRUE(str == view);
+            ASSERT_TRUE(str == text.c_str());
+            ASSERT_EQ(str == otherView, view == otherView);
+            ASSERT_EQ(str == other.c_str(), view == otherView);
+            ASSERT_EQ(str == *otherPlaced, view == otherView);
+
+            const FixedString<String::Capacity + 8> wider(otherView);        // Another capacity: the one-pass and length-bounded paths
+            ASSERT_EQ(str == wider, view == otherView);
+            ASSERT_EQ(wider == str, view == otherView);
+
+            ASSERT_EQ(Sign(str.Compare(otherView)), Sign(view.compare(otherView)));
+            ASSERT_EQ(Sign(str.Compare(*otherPlaced)), Sign(view.compare(otherView)));
+            ASSERT_EQ(Sign(str.Compare(other.c_str())), Sign(view.compare(otherView)));
+
+            ASSERT_EQ(str.Hash(), FixedStringDetail::Hash64(UnalignedText(text, offset).View().data(), text.size()));
+            ASSERT_EQ(str.Hash() == otherPlaced->Hash(), view == otherView);
+
+            const char probe = random.Byte();
+            const size_t pos = random.Between(0, Capacity + 1);
+            ASSERT_EQ(str.Find(probe), view.find(probe));
+            ASSERT_EQ(str.Find(probe, pos), view.find(probe, pos));
+            ASSERT_EQ(str.RFind(probe), view.rfind(probe));
+            ASSERT_EQ(str.RFind(probe, pos), view.rfind(probe, pos));
+
+            const std::string needle = text.empty() || random.OneIn(3) ? random.Text(random.Between(0, 4)) : text.substr(random.Between(0, text.size() - 1), random.Between(1, 9));
+            ASSERT_EQ(str.Find(needle), view.find(needle));
+            ASSERT_EQ(str.Find(needle, pos), view.find(needle, pos));
+
+            const std::string set = random.Text(random.Between(0, 6));
+            ASSERT_EQ(str.FindFirstOf(set), view.find_first_of(set));
+            ASSERT_EQ(str.FindFirstOf(set, pos), view.find_first_of(set, pos));
+            ASSERT_EQ(str.FindFirstNotOf(set), view.find_first_not_of(set));
+            ASSERT_EQ(str.FindFirstNotOf(set, pos), view.find_first_not_of(set, pos));
+        }
+    }
+}
+
+
+TYPED_TEST(FastPathTest, TruncateLeavesStaleTail)
+{
+    using String = TypeParam;
+    constexpr size_t Capacity = Shape<String>::Capacity;
+
+    TestRandom random(Shape<String>::Seed + 1000);
+
+    for (int c = 0; c < CasesPerType; ++c)
+    {
+        const std::string text = random.Text(Capacity);
+        const size_t cut = random.Length(Capacity);
+        const std::string_view kept = std::string_view(text).substr(0, cut);
+
+        String str(text);
+        str.Truncate(cut);
+
+        ASSERT_EQ(str.length(), cut);
+        ASSERT_TRUE(str == kept);
+        ASSERT_FALSE(cut < Capacity && str == std::string_view(text));
+        ASSERT_TRUE(str == String(kept));
+        ASSERT_EQ(str.Compare(std::string_view(text)) < 0, cut < Capacity);
+        ASSERT_EQ(str.Hash(), String(kept).Hash());
+
+        const char probe = text.empty() ? 'a' : text.back();
+        ASSERT_EQ(str.Find(probe), kept.find(probe));
+        ASSERT_EQ(str.RFind(probe), kept.rfind(probe));
+    }
+}
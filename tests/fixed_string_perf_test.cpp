@@ -0,0 +1,181 @@
+// ============================================================================
+// TextCPP - High Performance String Utility Library
+// ----------------------------------------------------------------------------
+// File:        fixed_string_perf_test.cpp
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#include "fixed_string.h"
+#include "test_support.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#ifndef TEXTCPP_PERF_MAX_RATIO
+#define TEXTCPP_PERF_MAX_RATIO 1.25
+#endif
+
+
+/// <summary>
+/// Regression thresholds for the fast paths. Each test times a FixedString operation and the same
+/// operation done the plain way, through std::string_view over c_str(), on the same strings, and fails
+/// if the fast path takes more than TEXTCPP_PERF_MAX_RATIO times as long. A ratio, rather than an
+/// absolute time, keeps the check independent of the machine. This file is built without sanitizers
+/// or FIXED_STRING_VERIFY_FAST_PATHS so the paths are timed as they ship.
+/// </summary>
+namespace
+{
+    constexpr size_t StringCount = 64;
+    constexpr int Repetitions = 25;                             // The best repetition is kept, which filters out preemption
+    constexpr auto MinRepetitionTime = std::chrono::milliseconds(2);
+
+    /// <summary>
+    /// Keeps value alive and makes the compiler assume memory changed, so calls are neither removed nor
+    /// hoisted out of the timing loop.
+    /// </summary>
+    template<typename T>
+    void Escape(const T& value)
+    {
+#if defined(_MSC_VER)
+        (void)value;
+        _ReadWriteBarrier();
+#else
+        asm volatile("" : : "r"(&value) : "memory");
+#endif
+    }
+
+    /// <summary>
+    /// Number of passes of body that take at least MinRepetitionTime.
+    /// </summary>
+    size_t PassesPerRepetition(const std::function<void()>& body)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        size_t passes = 1;
+        while (true)
+        {
+            const auto start = Clock::now();
+            for (size_t p = 0; p < passes; ++p) body();
+            if (Clock::now() - start >= MinRepetitionTime) return passes;
+            passes *= 2;
+        }
+    }
+
+    /// <summary>
+    /// Time per pass of body, in nanoseconds, over one repetition.
+    /// </summary>
+    double PassTime(const std::function<void()>& body, size_t passes)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        const auto start = Clock::now();
+        for (size_t p = 0; p < passes; ++p) body();
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / static_cast<double>(passes);
+    }
+
+    /// <summary>
+    /// Times fast and reference and fails the test if fast is slower than the threshold allows. The
+    /// repetitions alternate between the two, so a slow patch on a shared machine hits both, and the
+    /// best of each is compared.
+    /// </summary>
+    void ExpectWithinRatio(const char* operation, size_t n, const std::function<void()>& fast, const std::function<void()>& reference)
+    {
+        const size_t fastPasses = PassesPerRepetition(fast);
+        const size_t referencePasses = PassesPerRepetition(reference);
+
+        double fastTime = PassTime(fast, fastPasses);
+        double referenceTime = PassTime(reference, referencePasses);
+
+        for (int r = 1; r < Repetitions; ++r)
+        {
+            fastTime = std::min(fastTime, PassTime(fast, fastPasses));
+            referenceTime = std::min(referenceTime, PassTime(reference, referencePasses));
+        }
+
+        const double ratio = fastTime / referenceTime;
+
+        std::printf("%-8s N=%-5zu fast %9.1f ns  reference %9.1f ns  ratio %.2f\n", operation, n, fastTime, referenceTime, ratio);
+
+        EXPECT_LE(ratio, TEXTCPP_PERF_MAX_RATIO) << operation << " for N = " << n << " is " << ratio
+                                                 << "x the std::string_view reference";
+    }
+
+    constexpr char Absent = '\x01';                             // Removed from the text, so Find scans the whole string
+
+    /// <summary>
+    /// StringCount strings of random lengths in [N / 2, N - 1], and their text in separate storage, so
+    /// comparisons read two buffers.
+    /// </summary>
+    template<size_t N>
+    struct PerfStrings
+    {
+        PerfStrings()
+        {
+            TestRandom random(static_cast<uint32_t>(N));
+
+            for (size_t i = 0; i < StringCount; ++i)
+            {
+                Text[i] = random.Text(random.Between(N / 2, N - 1));
+                std::replace(Text[i].begin(), Text[i].end(), Absent, 'a');
+                Strings[i] = Text[i];
+                if constexpr (N <= 256) Stored[i] = Text[i];
+            }
+        }
+
+        FixedString<N> Strings[StringCount];
+        FixedString<std::min<size_t>(N, 256), LengthPolicy::Stored> Stored[StringCount];     // Stored allows N up to 256
+        std::string Text[StringCount];
+    };
+
+    template<size_t N>
+    void RunPerfChecks()
+    {
+        static const PerfStrings<N> data;
+        const auto& strings = data.Strings;
+        const auto& stored = data.Stored;
+        const auto& text = data.Text;
+
+        ExpectWithinRatio("length", N,
+            [&]() { for (const auto& s : strings) Escape(s.length()); },
+            [&]() { for (const auto& s : strings) Escape(std::strlen(s.c_str())); });
+
+        ExpectWithinRatio("==", N,
+            [&]() { for (size_t i = 0; i < StringCount; ++i) Escape(strings[i] == std::string_view(text[i])); },
+            [&]() { for (size_t i = 0; i < StringCount; ++i) Escape(std::string_view(strings[i].c_str()) == std::string_view(text[i])); });
+
+        ExpectWithinRatio("Find", N,
+            [&]() { for (const auto& s : strings) Escape(s.Find(Absent)); },
+            [&]() { for (const auto& s : strings) Escape(std::string_view(s.c_str()).find(Absent)); });
+
+        if constexpr (N <= 256)
+        {
+            ExpectWithinRatio("Find/St", N,
+                [&]() { for (const auto& s : stored) Escape(s.Find(Absent)); },
+                [&]() { for (const auto& s : stored) Escape(std::string_view(s.c_str(), s.length()).find(Absent)); });
+        }
+
+        ExpectWithinRatio("Hash", N,
+            [&]() { for (const auto& s : strings) Escape(s.Hash()); },
+            [&]() { for (const auto& s : strings) Escape(std::hash<std::string_view>{}(std::string_view(s.c_str()))); });
+    }
+}
+
+
+TEST(FixedStringPerf, Capacity64) { RunPerfChecks<64>(); }
+TEST(FixedStringPerf, Capacity256) { RunPerfChecks<256>(); }
+TEST(FixedStringPerf, Capacity1024) { RunPerfChecks<1024>(); }
@@ -0,0 +1,111 @@
+// ============================================================================
+// TextCPP - High Performance String Utility Library
+// ----------------------------------------------------------------------------
+// File:        test_support.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+
+#ifndef __TEST_SUPPORT_H_GUARD
+#define __TEST_SUPPORT_H_GUARD
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+/// <summary>
+/// Seeded generator for the fuzz tests, so a failure reproduces on every run.
+/// </summary>
+class TestRandom
+{
+    public:
+        explicit TestRandom(uint32_t seed) : Engine(seed) {}
+
+        /// <summary>
+        /// A uniform value in [low, high].
+        /// </summary>
+        size_t Between(size_t low, size_t high) { return std::uniform_int_distribution<size_t>(low, high)(Engine); }
+
+        /// <summary>
+        /// True with probability 1 / n.
+        /// </summary>
+        bool OneIn(size_t n) { return Between(1, n) == 1; }
+
+        /// <summary>
+        /// A non-zero byte. Mostly from a four-letter alphabet, so searches and comparisons hit and near-miss
+        /// often; sometimes any byte from 1 to 255, including the high half.
+        /// </summary>
+        char Byte()
+        {
+            if (OneIn(4)) return static_cast<char>(Between(1, 255));
+            return "abcd"[Between(0, 3)];
+        }
+
+        /// <summary>
+        /// length non-zero bytes.
+        /// </summary>
+        std::string Text(size_t length)
+        {
+            std::string text(length, '\0');
+            for (char& c : text) c = Byte();
+            return text;
+        }
+
+        /// <summary>
+        /// A length for a buffer of capacity characters, weighted towards 0, 1 and the last two that fit.
+        /// </summary>
+        size_t Length(size_t capacity)
+        {
+            switch (Between(0, 5))
+            {
+                case 0: return 0;
+                case 1: return capacity < 1 ? 0 : 1;
+                case 2: return capacity;
+                case 3: return capacity < 1 ? 0 : capacity - 1;
+                default: return Between(0, capacity);
+            }
+        }
+
+        std::mt19937& Generator() { return Engine; }
+
+    private:
+        std::mt19937 Engine;
+};
+
+
+/// <summary>
+/// A copy of text at offset bytes past a fresh allocation of exactly offset + text.size() bytes, so the
+/// view is misaligned by offset and any read past its end is a heap overflow under AddressSanitizer.
+/// </summary>
+class UnalignedText
+{
+    public:
+        UnalignedText(std::string_view text, size_t offset) : Bytes(offset + text.size()), Offset(offset)
+        {
+            if (!text.empty()) std::memcpy(Bytes.data() + offset, text.data(), text.size());
+        }
+
+        std::string_view View() const { return std::string_view(Bytes.data() + Offset, Bytes.size() - Offset); }
+
+    private:
+        std::vector<char> Bytes;
+        size_t Offset;
+};
+
+
+
+#endif